@@ -0,0 +1,139 @@
+/*******************************************************************************************
+*
+*   raylib [models] example - Mesh batch (multi-draw indirect)
+*
+*   Example originally created with raylib 5.1-dev, last time updated with raylib 5.1-dev
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   Draws thousands of objects using a few different meshes, comparing one DrawMesh() call
+*   per object vs a single DrawMeshBatch() call with all meshes packed in shared buffers
+*
+*   NOTE: Multi-draw indirect requires OpenGL 4.3 (GRAPHICS_API_OPENGL_43), on older OpenGL
+*   versions DrawMeshBatch() draws meshes one by one, still avoiding per-mesh state changes
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "raymath.h"        // Required for: MatrixRotateY(), MatrixTranslate(), MatrixMultiply()
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#define MAX_MESHES          5
+#define GRID_WIDTH        100
+#define GRID_LENGTH        50
+#define MAX_OBJECTS     (GRID_WIDTH*GRID_LENGTH)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [models] example - mesh batch");
+
+    // Define the camera to look into our 3d world
+    Camera camera = { 0 };
+    camera.position = (Vector3){ 60.0f, 40.0f, 60.0f };
+    camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera.fovy = 45.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+
+    // Generate some meshes, all of them provide the same vertex attributes
+    Mesh meshes[MAX_MESHES] = { 0 };
+    meshes[0] = GenMeshCube(1.0f, 1.0f, 1.0f);
+    meshes[1] = GenMeshSphere(0.6f, 12, 12);
+    meshes[2] = GenMeshCylinder(0.5f, 1.0f, 12);
+    meshes[3] = GenMeshTorus(0.3f, 1.0f, 12, 16);
+    meshes[4] = GenMeshKnot(0.5f, 1.0f, 12, 64);
+
+    // Load mesh batch, meshes vertex data is packed in shared GPU buffers
+    MeshBatch batch = LoadMeshBatch(meshes, MAX_MESHES);
+
+    Material material = LoadMaterialDefault();
+    material.maps[MATERIAL_MAP_DIFFUSE].color = SKYBLUE;
+
+    // Objects mesh and transform
+    int *meshIds = (int *)malloc(MAX_OBJECTS*sizeof(int));
+    Matrix *transforms = (Matrix *)malloc(MAX_OBJECTS*sizeof(Matrix));
+
+    for (int i = 0; i < MAX_OBJECTS; i++) meshIds[i] = GetRandomValue(0, MAX_MESHES - 1);
+
+    bool useBatch = true;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        UpdateCamera(&camera, CAMERA_ORBITAL);
+
+        if (IsKeyPressed(KEY_SPACE)) useBatch = !useBatch;
+
+        // Update objects transforms, every object rotates around its own axis
+        float time = (float)GetTime();
+        for (int z = 0; z < GRID_LENGTH; z++)
+        {
+            for (int x = 0; x < GRID_WIDTH; x++)
+            {
+                int i = z*GRID_WIDTH + x;
+                transforms[i] = MatrixMultiply(MatrixRotateY(time + i*0.1f),
+                    MatrixTranslate((x - GRID_WIDTH/2)*1.5f, 0.0f, (z - GRID_LENGTH/2)*1.5f));
+            }
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+
+                if (useBatch) DrawMeshBatch(batch, material, meshIds, transforms, MAX_OBJECTS);
+                else for (int i = 0; i < MAX_OBJECTS; i++) DrawMesh(meshes[meshIds[i]], material, transforms[i]);
+
+            EndMode3D();
+
+            DrawRectangle(10, 10, 330, 60, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(10, 10, 330, 60, BLUE);
+            DrawText(TextFormat("OBJECTS: %i", MAX_OBJECTS), 20, 20, 10, BLACK);
+            DrawText(useBatch? "MODE: DrawMeshBatch()" : "MODE: DrawMesh() per object", 20, 35, 10, useBatch? DARKGREEN : MAROON);
+            DrawText("Press SPACE to switch drawing mode", 20, 50, 10, DARKGRAY);
+
+            DrawFrameStats(10, 80);
+            DrawFPS(screenWidth - 100, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(meshIds);
+    free(transforms);
+
+    UnloadMeshBatch(batch);             // Unload mesh batch shared buffers
+    for (int i = 0; i < MAX_MESHES; i++) UnloadMesh(meshes[i]);
+    UnloadMaterial(material);           // Unload material (default shader is not unloaded)
+
+    CloseWindow();                      // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
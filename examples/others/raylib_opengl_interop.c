@@ -47,7 +47,7 @@
     #define GLSL_VERSION            100
 #endif
 
-#include "rlgl.h"           // Required for: rlDrawRenderBatchActive(), rlGetMatrixModelview(), rlGetMatrixProjection()
+#include "rlgl.h"           // Required for: rlDrawRenderBatchActive(), rlGetMatrixModelview(), rlGetMatrixProjection(), rlInvalidateStateCache()
 #include "raymath.h"        // Required for: MatrixMultiply(), MatrixToFloat()
 
 #define MAX_PARTICLES       1000
@@ -145,6 +145,8 @@ int main(void)
                 glBindVertexArray(0);
                 
             glUseProgram(0);
+
+            rlInvalidateStateCache();       // OpenGL state changed out of rlgl, invalidate internal state cache
             //------------------------------------------------------------------------------
             
             DrawFPS(screenWidth - 100, 10);
@@ -0,0 +1,150 @@
+/*******************************************************************************************
+*
+*   raylib [shaders] example - Shader program binary cache (startup time benchmark)
+*
+*   Example originally created with raylib 5.1-dev, last time updated with raylib 5.1-dev
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   Measures the time required to load a number of shader program variants compiling them
+*   from GLSL code vs loading them from driver program binaries (rlGetShaderProgramBinary()),
+*   the same process used by LoadShader() when SUPPORT_SHADER_BINARY_CACHE is enabled in config.h
+*
+*   NOTE: Program binaries require OpenGL 4.1 (or GL_ARB_get_program_binary) or OpenGL ES 3.0,
+*   not available on OpenGL ES 2.0 and WebGL
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "rlgl.h"           // Required for: rlLoadShaderCode(), rlGetShaderProgramBinary(), rlLoadShaderProgramBinary()
+
+#include <stdlib.h>         // Required for: free()
+
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_ANDROID, PLATFORM_WEB
+    #define GLSL_VERSION            100
+#endif
+
+#define MAX_SHADER_VARIANTS     120
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shaders] example - shader program binary cache");
+
+    // Fragment shader code template, every variant uses a different number of loop iterations
+    // so driver can not reuse a previously compiled program
+#if (GLSL_VERSION == 330)
+    const char *fsTemplate =
+        "#version 330\n"
+        "#define VARIANT %i\n"
+        "in vec2 fragTexCoord; in vec4 fragColor; out vec4 finalColor;\n"
+        "uniform sampler2D texture0; uniform vec4 colDiffuse;\n"
+        "void main() {\n"
+        "    vec4 color = texture(texture0, fragTexCoord)*colDiffuse*fragColor;\n"
+        "    for (int i = 0; i < VARIANT%%8 + 1; i++) color.rgb += 0.01*sin(fragTexCoord.x*float(i + VARIANT));\n"
+        "    finalColor = color;\n"
+        "}\n";
+#else
+    const char *fsTemplate =
+        "#version 100\n"
+        "precision mediump float;\n"
+        "#define VARIANT %i\n"
+        "varying vec2 fragTexCoord; varying vec4 fragColor;\n"
+        "uniform sampler2D texture0; uniform vec4 colDiffuse;\n"
+        "void main() {\n"
+        "    vec4 color = texture2D(texture0, fragTexCoord)*colDiffuse*fragColor;\n"
+        "    for (int i = 0; i < VARIANT - (VARIANT/8)*8 + 1; i++) color.rgb += 0.01*sin(fragTexCoord.x*float(i + VARIANT));\n"
+        "    gl_FragColor = color;\n"
+        "}\n";
+#endif
+
+    unsigned int programs[MAX_SHADER_VARIANTS] = { 0 };
+    unsigned char *binaries[MAX_SHADER_VARIANTS] = { 0 };
+    int binarySizes[MAX_SHADER_VARIANTS] = { 0 };
+
+    SetTraceLogLevel(LOG_WARNING);      // Avoid logging every shader loading, it affects timings
+
+    // Benchmark: Compile shader programs from code
+    double startTime = GetTime();
+    for (int i = 0; i < MAX_SHADER_VARIANTS; i++) programs[i] = rlLoadShaderCode(NULL, TextFormat(fsTemplate, i));
+    double compileTime = GetTime() - startTime;
+
+    // Retrieve program binaries (stored on disk by LoadShader() shader cache)
+    int binaryCount = 0;
+    for (int i = 0; i < MAX_SHADER_VARIANTS; i++)
+    {
+        binaries[i] = rlGetShaderProgramBinary(programs[i], &binarySizes[i]);
+        if (binaries[i] != NULL) binaryCount++;
+
+        rlUnloadShaderProgram(programs[i]);
+        programs[i] = 0;
+    }
+
+    // Benchmark: Load shader programs from binaries
+    double binaryTime = 0.0;
+    if (binaryCount == MAX_SHADER_VARIANTS)
+    {
+        startTime = GetTime();
+        for (int i = 0; i < MAX_SHADER_VARIANTS; i++) programs[i] = rlLoadShaderProgramBinary(binaries[i], binarySizes[i]);
+        binaryTime = GetTime() - startTime;
+    }
+
+    SetTraceLogLevel(LOG_INFO);
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("SHADER PROGRAM VARIANTS: %i", MAX_SHADER_VARIANTS), 40, 40, 20, DARKGRAY);
+
+            DrawText(TextFormat("Compiled from GLSL code: %.2f ms", compileTime*1000.0), 40, 100, 20, MAROON);
+
+            if (binaryCount == MAX_SHADER_VARIANTS)
+            {
+                DrawText(TextFormat("Loaded from program binaries: %.2f ms", binaryTime*1000.0), 40, 140, 20, DARKGREEN);
+                if (binaryTime > 0.0) DrawText(TextFormat("Speedup: x%.1f", compileTime/binaryTime), 40, 180, 20, DARKBLUE);
+            }
+            else DrawText("Program binaries not supported by current OpenGL driver", 40, 140, 20, GRAY);
+
+            DrawText("Enable SUPPORT_SHADER_BINARY_CACHE in config.h to cache LoadShader() programs on disk", 40, screenHeight - 40, 10, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < MAX_SHADER_VARIANTS; i++)
+    {
+        if (programs[i] > 0) rlUnloadShaderProgram(programs[i]);
+        free(binaries[i]);              // NOTE: Binary data allocated by rlgl with RL_MALLOC()
+    }
+
+    CloseWindow();                      // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+/*******************************************************************************************
+*
+*   raylib [shapes] example - Collision broadphase
+*
+*   Example originally created with raylib 5.1-dev, last time updated with raylib 5.1-dev
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   Benchmark of collision detection between thousands of moving rectangles,
+*   comparing brute force (every pair tested) vs broadphase pairs enumeration
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#define MAX_ENTITIES    20000
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shapes] example - collision broadphase");
+
+    // Entities data, stored as separate arrays to be used by DrawRectanglesBatch()
+    Rectangle *recs = (Rectangle *)malloc(MAX_ENTITIES*sizeof(Rectangle));
+    Vector2 *speeds = (Vector2 *)malloc(MAX_ENTITIES*sizeof(Vector2));
+    Color *colors = (Color *)malloc(MAX_ENTITIES*sizeof(Color));
+    int *ids = (int *)malloc(MAX_ENTITIES*sizeof(int));         // Broadphase proxy id per entity
+    int *entities = (int *)malloc(MAX_ENTITIES*sizeof(int));    // Entity per broadphase proxy id
+    int *pairs = (int *)malloc(2*MAX_ENTITIES*8*sizeof(int));   // Colliding pairs ids
+    int maxPairs = MAX_ENTITIES*8;
+
+    // Broadphase cell size similar to entities size
+    Broadphase broadphase = LoadBroadphase(8.0f, MAX_ENTITIES);
+
+    for (int i = 0; i < MAX_ENTITIES; i++)
+    {
+        recs[i] = (Rectangle){ (float)GetRandomValue(0, screenWidth - 4), (float)GetRandomValue(0, screenHeight - 4), 4.0f, 4.0f };
+        speeds[i] = (Vector2){ GetRandomValue(-100, 100)/100.0f, GetRandomValue(-100, 100)/100.0f };
+    }
+
+    int entitiesCount = 5000;
+
+    // Register entities in broadphase, only entities in use
+    for (int i = 0; i < entitiesCount; i++)
+    {
+        ids[i] = AddBroadphaseRec(&broadphase, recs[i]);
+        entities[ids[i]] = i;
+    }
+    int collisionsCount = 0;
+    double collisionTime = 0.0;
+    bool useBroadphase = true;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) useBroadphase = !useBroadphase;
+        if (IsKeyPressed(KEY_UP) && (entitiesCount < MAX_ENTITIES))
+        {
+            for (int i = entitiesCount; i < entitiesCount + 1000; i++)
+            {
+                ids[i] = AddBroadphaseRec(&broadphase, recs[i]);
+                entities[ids[i]] = i;
+            }
+            entitiesCount += 1000;
+        }
+        if (IsKeyPressed(KEY_DOWN) && (entitiesCount > 1000))
+        {
+            entitiesCount -= 1000;
+            for (int i = entitiesCount; i < entitiesCount + 1000; i++) RemoveBroadphaseProxy(&broadphase, ids[i]);
+        }
+
+        for (int i = 0; i < entitiesCount; i++)
+        {
+            recs[i].x += speeds[i].x;
+            recs[i].y += speeds[i].y;
+
+            if ((recs[i].x < 0) || ((recs[i].x + recs[i].width) > screenWidth)) speeds[i].x *= -1;
+            if ((recs[i].y < 0) || ((recs[i].y + recs[i].height) > screenHeight)) speeds[i].y *= -1;
+
+            colors[i] = DARKGRAY;
+        }
+
+        // Detect collisions, colliding entities are drawn in red
+        double startTime = GetTime();
+
+        collisionsCount = 0;
+
+        if (useBroadphase)
+        {
+            // NOTE: Broadphase pairs are proxies ids, already tested with CheckCollisionRecs()
+            for (int i = 0; i < entitiesCount; i++) UpdateBroadphaseRec(&broadphase, ids[i], recs[i]);
+
+            collisionsCount = GetBroadphasePairs(broadphase, pairs, maxPairs);
+
+            for (int i = 0; i < collisionsCount; i++)
+            {
+                colors[entities[pairs[2*i]]] = RED;
+                colors[entities[pairs[2*i + 1]]] = RED;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < entitiesCount; i++)
+            {
+                for (int j = i + 1; j < entitiesCount; j++)
+                {
+                    if (CheckCollisionRecs(recs[i], recs[j]))
+                    {
+                        colors[i] = RED;
+                        colors[j] = RED;
+                        collisionsCount++;
+                    }
+                }
+            }
+        }
+
+        collisionTime = GetTime() - startTime;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawRectanglesBatch(recs, colors, entitiesCount);
+
+            DrawRectangle(10, 10, 340, 90, Fade(SKYBLUE, 0.8f));
+            DrawRectangleLines(10, 10, 340, 90, BLUE);
+            DrawText(TextFormat("ENTITIES: %i (UP/DOWN to change)", entitiesCount), 20, 20, 10, BLACK);
+            DrawText(useBroadphase? "MODE: Broadphase (sweep-and-prune)" : "MODE: Brute force (all pairs)", 20, 35, 10, useBroadphase? DARKGREEN : MAROON);
+            DrawText(TextFormat("COLLISIONS: %i", collisionsCount), 20, 50, 10, BLACK);
+            DrawText(TextFormat("COLLISION TIME: %.2f ms", collisionTime*1000.0), 20, 65, 10, BLACK);
+            DrawText("Press SPACE to switch collision mode", 20, 80, 10, DARKGRAY);
+
+            DrawFPS(screenWidth - 100, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadBroadphase(broadphase);       // Unload broadphase spatial index
+
+    free(recs);
+    free(speeds);
+    free(colors);
+    free(ids);
+    free(entities);
+    free(pairs);
+
+    CloseWindow();                      // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
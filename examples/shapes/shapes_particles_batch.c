@@ -0,0 +1,127 @@
+/*******************************************************************************************
+*
+*   raylib [shapes] example - Particles batch
+*
+*   Example originally created with raylib 5.1-dev, last time updated with raylib 5.1-dev
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   Draws thousands of particles, comparing one DrawCircleV()/DrawRectangleRec() call
+*   per particle vs a single DrawCirclesBatch()/DrawRectanglesBatch() call for all of them
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#define MAX_PARTICLES   100000
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shapes] example - particles batch");
+
+    // Particles data, stored as separate arrays to be used by batch functions
+    Vector2 *positions = (Vector2 *)malloc(MAX_PARTICLES*sizeof(Vector2));
+    Vector2 *speeds = (Vector2 *)malloc(MAX_PARTICLES*sizeof(Vector2));
+    float *radiuses = (float *)malloc(MAX_PARTICLES*sizeof(float));
+    Rectangle *recs = (Rectangle *)malloc(MAX_PARTICLES*sizeof(Rectangle));
+    Color *colors = (Color *)malloc(MAX_PARTICLES*sizeof(Color));
+
+    for (int i = 0; i < MAX_PARTICLES; i++)
+    {
+        positions[i] = (Vector2){ (float)GetRandomValue(0, screenWidth), (float)GetRandomValue(0, screenHeight) };
+        speeds[i] = (Vector2){ GetRandomValue(-200, 200)/100.0f, GetRandomValue(-200, 200)/100.0f };
+        radiuses[i] = 2.0f;
+        colors[i] = (Color){ GetRandomValue(50, 240), GetRandomValue(80, 240), GetRandomValue(100, 240), 255 };
+    }
+
+    int particlesCount = 10000;
+    bool useBatch = true;
+    bool drawCircles = true;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) useBatch = !useBatch;
+        if (IsKeyPressed(KEY_C)) drawCircles = !drawCircles;
+        if (IsKeyPressed(KEY_UP)) particlesCount = (particlesCount*2 > MAX_PARTICLES)? MAX_PARTICLES : particlesCount*2;
+        if (IsKeyPressed(KEY_DOWN)) particlesCount = (particlesCount/2 < 1000)? 1000 : particlesCount/2;
+
+        for (int i = 0; i < particlesCount; i++)
+        {
+            positions[i].x += speeds[i].x;
+            positions[i].y += speeds[i].y;
+
+            if ((positions[i].x < 0) || (positions[i].x > screenWidth)) speeds[i].x *= -1;
+            if ((positions[i].y < 0) || (positions[i].y > screenHeight)) speeds[i].y *= -1;
+
+            recs[i] = (Rectangle){ positions[i].x - 2.0f, positions[i].y - 2.0f, 4.0f, 4.0f };
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            if (useBatch)
+            {
+                if (drawCircles) DrawCirclesBatch(positions, radiuses, colors, particlesCount);
+                else DrawRectanglesBatch(recs, colors, particlesCount);
+            }
+            else
+            {
+                for (int i = 0; i < particlesCount; i++)
+                {
+                    if (drawCircles) DrawCircleV(positions[i], radiuses[i], colors[i]);
+                    else DrawRectangleRec(recs[i], colors[i]);
+                }
+            }
+
+            DrawRectangle(10, 10, 330, 75, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(10, 10, 330, 75, BLUE);
+            DrawText(TextFormat("PARTICLES: %i (UP/DOWN to change)", particlesCount), 20, 20, 10, BLACK);
+            DrawText(useBatch? "MODE: Draw*Batch()" : "MODE: Draw*() per particle", 20, 35, 10, useBatch? DARKGREEN : MAROON);
+            DrawText("Press SPACE to switch drawing mode", 20, 50, 10, DARKGRAY);
+            DrawText("Press C to switch circles/rectangles", 20, 65, 10, DARKGRAY);
+
+            DrawFrameStats(10, 95);
+            DrawFPS(screenWidth - 100, 10);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(positions);
+    free(speeds);
+    free(radiuses);
+    free(recs);
+    free(colors);
+
+    CloseWindow();                      // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************************
+*
+*   raylib [shapes] example - Polygon mesh
+*
+*   Example originally created with raylib 5.1-dev, last time updated with raylib 5.1-dev
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   Concave polygon with a hole triangulated into a PolygonMesh, points can be dragged
+*   with the mouse, polygon is only triangulated again when points change
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>           // Required for: sinf(), cosf()
+
+#define OUTLINE_POINTS      16
+#define HOLE_POINTS         8
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shapes] example - polygon mesh");
+
+    // Polygon points: star outline followed by hole points
+    Vector2 points[OUTLINE_POINTS + HOLE_POINTS] = { 0 };
+    int holes[1] = { OUTLINE_POINTS };
+    Vector2 center = { screenWidth/2.0f, screenHeight/2.0f };
+
+    for (int i = 0; i < OUTLINE_POINTS; i++)
+    {
+        float radius = (i%2 == 0)? 200.0f : 90.0f;
+        float angle = (float)i/OUTLINE_POINTS*2.0f*PI;
+        points[i] = (Vector2){ center.x + radius*cosf(angle), center.y + radius*sinf(angle) };
+    }
+
+    for (int i = 0; i < HOLE_POINTS; i++)
+    {
+        float angle = (float)i/HOLE_POINTS*2.0f*PI;
+        points[OUTLINE_POINTS + i] = (Vector2){ center.x + 50.0f*cosf(angle), center.y + 50.0f*sinf(angle) };
+    }
+
+    PolygonMesh mesh = LoadPolygonMesh(points, OUTLINE_POINTS + HOLE_POINTS, holes, 1);
+
+    int selectedPoint = -1;
+    bool drawWires = false;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        Vector2 mouse = GetMousePosition();
+
+        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
+        {
+            for (int i = 0; i < OUTLINE_POINTS + HOLE_POINTS; i++)
+            {
+                if (CheckCollisionPointCircle(mouse, points[i], 8.0f)) selectedPoint = i;
+            }
+        }
+
+        if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT)) selectedPoint = -1;
+        if (selectedPoint != -1) points[selectedPoint] = mouse;
+
+        if (IsKeyPressed(KEY_SPACE)) drawWires = !drawWires;
+
+        // Polygon is triangulated again only if points changed
+        UpdatePolygonMesh(&mesh, points, OUTLINE_POINTS + HOLE_POINTS, holes, 1);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawPolygonMesh(mesh, (Vector2){ 0.0f, 0.0f }, SKYBLUE);
+
+            if (drawWires)
+            {
+                for (int i = 0; i < mesh.triangleCount; i++)
+                {
+                    Vector2 v1 = points[mesh.indices[3*i]];
+                    Vector2 v2 = points[mesh.indices[3*i + 1]];
+                    Vector2 v3 = points[mesh.indices[3*i + 2]];
+
+                    DrawTriangleLines(v1, v2, v3, Fade(DARKBLUE, 0.5f));
+                }
+            }
+
+            for (int i = 0; i < OUTLINE_POINTS + HOLE_POINTS; i++)
+            {
+                DrawCircleV(points[i], (i == selectedPoint)? 8.0f : 5.0f, (i < OUTLINE_POINTS)? MAROON : DARKGREEN);
+            }
+
+            DrawText(TextFormat("TRIANGLES: %i", mesh.triangleCount), 10, 10, 20, DARKGRAY);
+            DrawText("Drag points with mouse, press SPACE to toggle triangles wires", 10, 40, 10, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadPolygonMesh(mesh);        // Unload polygon mesh data
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
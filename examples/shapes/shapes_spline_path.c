@@ -0,0 +1,152 @@
+/*******************************************************************************************
+*
+*   raylib [shapes] example - Spline path
+*
+*   Example originally created with raylib 5.1-dev, last time updated with raylib 5.1-dev
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   Cubic bezier spline stroked into a SplinePath: adaptive flattening and joins are cached,
+*   path is only flattened again when control points are moved or camera zoom changes
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAX_SPLINE_POINTS      10
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [shapes] example - spline path");
+
+    // Cubic bezier control points: [p1, c2, c3, p4, c5, c6, p7...]
+    Vector2 points[MAX_SPLINE_POINTS] = {
+        { 50.0f, 400.0f }, { 100.0f, 100.0f }, { 200.0f, 100.0f }, { 250.0f, 250.0f },
+        { 300.0f, 400.0f }, { 450.0f, 400.0f }, { 500.0f, 200.0f },
+        { 550.0f, 50.0f }, { 700.0f, 50.0f }, { 750.0f, 300.0f }
+    };
+
+    const char *joinNames[3] = { "MITER", "BEVEL", "ROUND" };
+    int join = SPLINE_JOIN_ROUND;
+
+    SplinePath path = LoadSplinePath(SPLINE_BEZIER_CUBIC, points, MAX_SPLINE_POINTS, 16.0f, join);
+
+    Camera2D camera = { 0 };
+    camera.zoom = 1.0f;
+
+    int selectedPoint = -1;
+    bool drawWires = false;
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        float wheel = GetMouseWheelMove();
+
+        if (wheel != 0)
+        {
+            // Zoom to mouse position
+            camera.target = GetScreenToWorld2D(GetMousePosition(), camera);
+            camera.offset = GetMousePosition();
+            camera.zoom += wheel*0.25f*camera.zoom;
+            if (camera.zoom < 0.25f) camera.zoom = 0.25f;
+            if (camera.zoom > 32.0f) camera.zoom = 32.0f;
+        }
+
+        Vector2 mouse = GetScreenToWorld2D(GetMousePosition(), camera);
+
+        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
+        {
+            for (int i = 0; i < MAX_SPLINE_POINTS; i++)
+            {
+                if (CheckCollisionPointCircle(mouse, points[i], 8.0f/camera.zoom)) selectedPoint = i;
+            }
+        }
+
+        if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT)) selectedPoint = -1;
+        if (selectedPoint != -1) points[selectedPoint] = mouse;
+
+        if (IsKeyPressed(KEY_SPACE)) drawWires = !drawWires;
+
+        if (IsKeyPressed(KEY_J))
+        {
+            // Join type change requires a new path
+            join = (join + 1)%3;
+            UnloadSplinePath(path);
+            path = LoadSplinePath(SPLINE_BEZIER_CUBIC, points, MAX_SPLINE_POINTS, 16.0f, join);
+        }
+
+        // Spline is flattened again only if points changed or zoom changed significantly
+        UpdateSplinePath(&path, points, MAX_SPLINE_POINTS, camera.zoom);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            BeginMode2D(camera);
+
+                DrawSplinePath(path, Fade(RED, 0.6f));
+
+                if (drawWires)
+                {
+                    for (int i = 0; i < path.vertexCount; i += 3)
+                    {
+                        Vector2 v1 = { path.vertices[2*i], path.vertices[2*i + 1] };
+                        Vector2 v2 = { path.vertices[2*i + 2], path.vertices[2*i + 3] };
+                        Vector2 v3 = { path.vertices[2*i + 4], path.vertices[2*i + 5] };
+
+                        DrawTriangleLines(v1, v2, v3, DARKGRAY);
+                    }
+                }
+
+                // Draw control points and handles
+                for (int i = 0; i < MAX_SPLINE_POINTS - 1; i += 3)
+                {
+                    DrawLineV(points[i], points[i + 1], GRAY);
+                    DrawLineV(points[i + 2], points[i + 3], GRAY);
+                }
+
+                for (int i = 0; i < MAX_SPLINE_POINTS; i++)
+                {
+                    DrawCircleV(points[i], ((i == selectedPoint)? 8.0f : 5.0f)/camera.zoom, (i%3 == 0)? MAROON : DARKBLUE);
+                }
+
+            EndMode2D();
+
+            DrawText(TextFormat("JOIN: %s (J to change)", joinNames[join]), 10, 10, 20, DARKGRAY);
+            DrawText(TextFormat("TRIANGLES: %i - ZOOM: %.2f", path.vertexCount/3, camera.zoom), 10, 35, 20, DARKGRAY);
+            DrawText("Drag points with mouse, mouse wheel to zoom, SPACE to toggle wires", 10, 60, 10, GRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadSplinePath(path);         // Unload spline path data
+
+    CloseWindow();                  // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Font binary file
+*
+*   Example originally created with raylib 5.1-dev, last time updated with raylib 5.1-dev
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   Font exported to binary file (.rfnt) with ExportFont(), loading time compared to
+*   generating the font from TTF file, binary font is loaded without glyphs rasterization
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#define GLYPHS_COUNT    4000
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - font binary file");
+
+    // Glyphs set: ASCII characters, followed by CJK unified ideographs
+    int *codepoints = (int *)malloc(GLYPHS_COUNT*sizeof(int));
+    for (int i = 0; i < GLYPHS_COUNT; i++) codepoints[i] = (i < 95)? (i + 32) : (0x4e00 + i - 95);
+
+    // Generate font from TTF file, glyphs are rasterized and packed into atlas
+    double startTime = GetTime();
+    Font fontTtf = LoadFontEx("resources/DotGothic16-Regular.ttf", 32, codepoints, GLYPHS_COUNT);
+    double ttfTime = GetTime() - startTime;
+
+    // Export font to binary file and load it back, atlas is uploaded as stored
+    bool exported = ExportFont(fontTtf, "DotGothic16-Regular.rfnt");
+
+    startTime = GetTime();
+    Font fontBin = LoadFont("DotGothic16-Regular.rfnt");
+    double binTime = GetTime() - startTime;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // TODO: Update your variables here
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("FONT LOADING TIME (%i GLYPHS)", GLYPHS_COUNT), 20, 20, 20, DARKGRAY);
+            DrawText(TextFormat("TTF (glyphs rasterization): %.2f ms", ttfTime*1000.0), 40, 70, 20, MAROON);
+
+            if (exported)
+            {
+                DrawText(TextFormat("RFNT (binary file): %.2f ms", binTime*1000.0), 40, 100, 20, DARKGREEN);
+                if (binTime > 0.0) DrawText(TextFormat("SPEEDUP: x%.2f", ttfTime/binTime), 40, 130, 20, DARKGREEN);
+            }
+            else DrawText("Font could not be exported to binary file", 40, 100, 20, RED);
+
+            DrawTextEx(fontTtf, "TTF font: 一丁七万丈三上下", (Vector2){ 40, 200 }, 32, 2, DARKGRAY);
+            DrawTextEx(fontBin, "RFNT font: 一丁七万丈三上下", (Vector2){ 40, 250 }, 32, 2, DARKGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadFont(fontTtf);        // Unload font generated from TTF file
+    UnloadFont(fontBin);        // Unload font loaded from binary file
+    free(codepoints);
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Font dynamic
+*
+*   Example originally created with raylib 5.1-dev, last time updated with raylib 5.1-dev
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   Dynamic fonts keep TTF data loaded and rasterize glyphs on first use,
+*   no need to provide the codepoints required by the text in advance
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+// Text to be displayed, must be UTF-8 (save this code file as UTF-8)
+static const char *texts[] = {
+    "いろはにほへと　ちりぬるを\nわかよたれそ　つねならむ",
+    "うゐのおくやま　けふこえて\nあさきゆめみし　ゑひもせす",
+    "天地玄黄　宇宙洪荒\n日月盈昃　辰宿列張",
+    "The quick brown fox jumps\nover the lazy dog"
+};
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - font dynamic");
+
+    // Load dynamic font, only ASCII glyphs are preloaded
+    // NOTE: Required glyphs are rasterized into font atlas pages on first use
+    Font font = LoadFontDynamic("resources/DotGothic16-Regular.ttf", 36);
+
+    int currentText = 0;
+    bool showFontAtlas = false;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_RIGHT)) currentText = (currentText + 1)%4;
+        else if (IsKeyPressed(KEY_LEFT)) currentText = (currentText + 3)%4;
+
+        if (IsKeyPressed(KEY_SPACE)) showFontAtlas = !showFontAtlas;
+
+        Vector2 textSize = MeasureTextEx(font, texts[currentText], (float)font.baseSize, 2.0f);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText("Use LEFT/RIGHT to change text, SPACE to show font atlas", 20, 20, 20, DARKGRAY);
+
+            if (showFontAtlas)
+            {
+                // First atlas page is the font texture
+                DrawTexturePro(font.texture, (Rectangle){ 0, 0, 256, 256 }, (Rectangle){ 20, 60, 360, 360 }, (Vector2){ 0, 0 }, 0.0f, BLACK);
+                DrawRectangleLines(20, 60, 360, 360, MAROON);
+            }
+            else
+            {
+                DrawRectangleLines(screenWidth/2 - (int)textSize.x/2 - 10, screenHeight/2 - (int)textSize.y/2 - 10, (int)textSize.x + 20, (int)textSize.y + 20, LIGHTGRAY);
+                DrawTextEx(font, texts[currentText], (Vector2){ screenWidth/2 - textSize.x/2, screenHeight/2 - textSize.y/2 }, (float)font.baseSize, 2.0f, MAROON);
+            }
+
+            DrawText(IsFontDynamic(font)? "DYNAMIC FONT" : "STATIC FONT", screenWidth - 150, screenHeight - 30, 20, DARKGREEN);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadFont(font);                   // Unload dynamic font, all atlas pages are unloaded
+
+    CloseWindow();                      // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
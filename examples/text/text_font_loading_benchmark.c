@@ -0,0 +1,128 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Font loading benchmark
+*
+*   Example originally created with raylib 5.1-dev, last time updated with raylib 5.1-dev
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   Benchmark of font glyphs rasterization time [LoadFontData()] for 95, 2000 and 20000
+*   glyphs, bitmap and SDF modes, rasterizing glyphs on a single thread vs all processor cores
+*
+*   NOTE: One benchmark measure is taken per frame, SDF measures can take a few seconds
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>         // Required for: malloc(), free()
+
+#define GLYPH_SETS_COUNT     3
+#define FONT_TYPES_COUNT     2
+#define MEASURES_COUNT      (GLYPH_SETS_COUNT*FONT_TYPES_COUNT*2)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - font loading benchmark");
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData("resources/DotGothic16-Regular.ttf", &dataSize);
+
+    // Glyph sets: ASCII characters, followed by CJK unified ideographs
+    const int glyphCounts[GLYPH_SETS_COUNT] = { 95, 2000, 20000 };
+    const int fontTypes[FONT_TYPES_COUNT] = { FONT_DEFAULT, FONT_SDF };
+    const char *fontTypeNames[FONT_TYPES_COUNT] = { "BITMAP", "SDF" };
+
+    int *codepoints = (int *)malloc(glyphCounts[GLYPH_SETS_COUNT - 1]*sizeof(int));
+    for (int i = 0; i < glyphCounts[GLYPH_SETS_COUNT - 1]; i++) codepoints[i] = (i < 95)? (i + 32) : (0x4e00 + i - 95);
+
+    double times[MEASURES_COUNT] = { 0 };   // Measures: [type][set][threads]
+    int measureCount = 0;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_R)) measureCount = 0;
+
+        // Take next benchmark measure, rasterizing glyphs on a single thread or all processor cores
+        if ((fileData != NULL) && (measureCount < MEASURES_COUNT))
+        {
+            int type = measureCount/(GLYPH_SETS_COUNT*2);
+            int set = (measureCount/2)%GLYPH_SETS_COUNT;
+
+            SetFontLoadingThreads(((measureCount%2) == 0)? 1 : 0);
+
+            double startTime = GetTime();
+            GlyphInfo *glyphs = LoadFontData(fileData, dataSize, 32, codepoints, glyphCounts[set], fontTypes[type]);
+            times[measureCount] = GetTime() - startTime;
+
+            UnloadFontData(glyphs, glyphCounts[set]);
+
+            measureCount++;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText("FONT GLYPHS RASTERIZATION TIME", 20, 20, 20, DARKGRAY);
+            DrawText("MODE", 40, 70, 20, MAROON);
+            DrawText("GLYPHS", 160, 70, 20, MAROON);
+            DrawText("SINGLE THREAD", 300, 70, 20, MAROON);
+            DrawText("ALL CORES", 500, 70, 20, MAROON);
+            DrawText("SPEEDUP", 660, 70, 20, MAROON);
+
+            for (int i = 0; i < MEASURES_COUNT/2; i++)
+            {
+                int posY = 110 + i*40;
+
+                DrawText(fontTypeNames[i/GLYPH_SETS_COUNT], 40, posY, 20, DARKGRAY);
+                DrawText(TextFormat("%i", glyphCounts[i%GLYPH_SETS_COUNT]), 160, posY, 20, DARKGRAY);
+
+                if (measureCount > 2*i) DrawText(TextFormat("%.2f ms", times[2*i]*1000.0), 300, posY, 20, DARKGRAY);
+                if (measureCount > (2*i + 1))
+                {
+                    DrawText(TextFormat("%.2f ms", times[2*i + 1]*1000.0), 500, posY, 20, DARKGRAY);
+                    if (times[2*i + 1] > 0.0) DrawText(TextFormat("x%.2f", times[2*i]/times[2*i + 1]), 660, posY, 20, DARKGREEN);
+                }
+            }
+
+            if (fileData == NULL) DrawText("Font file could not be loaded", 20, screenHeight - 40, 20, RED);
+            else if (measureCount < MEASURES_COUNT) DrawText("Measuring...", 20, screenHeight - 40, 20, RED);
+            else DrawText("Press R to repeat benchmark", 20, screenHeight - 40, 20, DARKGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(codepoints);
+    UnloadFileData(fileData);
+
+    CloseWindow();                      // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*******************************************************************************************
+*
+*   raylib [text] example - Text layout
+*
+*   Example originally created with raylib 5.1-dev, last time updated with raylib 5.1-dev
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************
+*
+*   Text layouts keep glyphs quads computed for static text, avoiding text decoding and
+*   glyphs placement every frame, layout is only computed again when some input changes
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define MAX_LABELS      200
+
+static const char *text = "Text layouts are computed once and drawn every frame with a single call, "
+                          "lines are wrapped on spaces to fit the layout wrap width.";
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [text] example - text layout");
+
+    Font font = LoadFontEx("resources/pixantiqua.ttf", 32, 0, 250);
+
+    float wrapWidth = 360.0f;
+    TextLayout layout = LoadTextLayout(font, text, 20.0f, 1.0f, wrapWidth);
+
+    bool useLayout = true;
+    double drawTime = 0.0;
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())        // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) useLayout = !useLayout;
+
+        if (IsKeyDown(KEY_RIGHT)) wrapWidth += 2.0f;
+        else if (IsKeyDown(KEY_LEFT) && (wrapWidth > 40.0f)) wrapWidth -= 2.0f;
+
+        // NOTE: Layout is only computed again if wrap width changed
+        UpdateTextLayout(&layout, font, text, 20.0f, 1.0f, wrapWidth);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            double startTime = GetTime();
+
+            // Draw the same text multiple times, shifted labels in background
+            for (int i = 0; i < MAX_LABELS; i++)
+            {
+                Vector2 position = { (float)((i*37)%(screenWidth - 200)), (float)(120 + (i*53)%(screenHeight - 200)) };
+
+                if (useLayout) DrawTextLayout(layout, position, Fade(LIGHTGRAY, 0.3f));
+                else DrawTextEx(font, "Text layouts are computed once and drawn every frame", position, 20.0f, 1.0f, Fade(LIGHTGRAY, 0.3f));
+            }
+
+            drawTime = GetTime() - startTime;
+
+            DrawRectangle(20, 120, (int)wrapWidth, (int)layout.size.y, Fade(SKYBLUE, 0.3f));
+            DrawTextLayout(layout, (Vector2){ 20.0f, 120.0f }, MAROON);
+
+            DrawText("Use LEFT/RIGHT to change wrap width, SPACE to change drawing mode", 20, 20, 20, DARKGRAY);
+            DrawText(useLayout? "MODE: DrawTextLayout()" : "MODE: DrawTextEx()", 20, 50, 20, useLayout? DARKGREEN : MAROON);
+            DrawText(TextFormat("LABELS DRAW TIME: %.3f ms (%i labels)", drawTime*1000.0, MAX_LABELS), 20, 80, 20, DARKGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTextLayout(layout);           // Unload text layout data
+    UnloadFont(font);                   // Unload font
+
+    CloseWindow();                      // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -2,13 +2,18 @@
 *
 *   raylib [textures] example - Bunnymark
 *
-*   Example originally created with raylib 1.6, last time updated with raylib 2.5
+*   Example originally created with raylib 1.6, last time updated with raylib 5.1-dev
 *
 *   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
 *   BSD-like license that allows static linking with closed source software
 *
 *   Copyright (c) 2014-2024 Ramon Santamaria (@raysan5)
 *
+********************************************************************************************
+*
+*   NOTE: Press SPACE to switch between one DrawTexture() call per bunny
+*   and a single DrawTextureBatch() call for all bunnies
+*
 ********************************************************************************************/
 
 #include "raylib.h"
@@ -44,7 +49,12 @@ int main(void)
 
     Bunny *bunnies = (Bunny *)malloc(MAX_BUNNIES*sizeof(Bunny));    // Bunnies array
 
+    // Bunnies drawing data for DrawTextureBatch(), separate arrays are required
+    Rectangle *bunniesDest = (Rectangle *)malloc(MAX_BUNNIES*sizeof(Rectangle));
+    Color *bunniesTint = (Color *)malloc(MAX_BUNNIES*sizeof(Color));
+
     int bunniesCount = 0;           // Bunnies counter
+    bool useBatch = false;          // Use DrawTextureBatch() for all bunnies
 
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -72,6 +82,8 @@ int main(void)
             }
         }
 
+        if (IsKeyPressed(KEY_SPACE)) useBatch = !useBatch;
+
         // Update bunnies
         for (int i = 0; i < bunniesCount; i++)
         {
@@ -82,6 +94,9 @@ int main(void)
                 ((bunnies[i].position.x + texBunny.width/2) < 0)) bunnies[i].speed.x *= -1;
             if (((bunnies[i].position.y + texBunny.height/2) > GetScreenHeight()) ||
                 ((bunnies[i].position.y + texBunny.height/2 - 40) < 0)) bunnies[i].speed.y *= -1;
+
+            bunniesDest[i] = (Rectangle){ (float)(int)bunnies[i].position.x, (float)(int)bunnies[i].position.y, (float)texBunny.width, (float)texBunny.height };
+            bunniesTint[i] = bunnies[i].color;
         }
         //----------------------------------------------------------------------------------
 
@@ -91,7 +106,13 @@ int main(void)
 
             ClearBackground(RAYWHITE);
 
-            for (int i = 0; i < bunniesCount; i++)
+            if (useBatch)
+            {
+                // Draw all bunnies with a single call, quads vertex data is generated in chunks
+                // NOTE: Source rectangles, origins and rotations are not required (NULL)
+                DrawTextureBatch(texBunny, NULL, bunniesDest, NULL, NULL, bunniesTint, bunniesCount);
+            }
+            else for (int i = 0; i < bunniesCount; i++)
             {
                 // NOTE: When internal batch buffer limit is reached (MAX_BATCH_ELEMENTS),
                 // a draw call is launched and buffer starts being filled again;
@@ -106,6 +127,8 @@ int main(void)
             DrawText(TextFormat("bunnies: %i", bunniesCount), 120, 10, 20, GREEN);
             DrawText(TextFormat("batched draw calls: %i", 1 + bunniesCount/MAX_BATCH_ELEMENTS), 320, 10, 20, MAROON);
 
+            DrawText(useBatch? "MODE: DrawTextureBatch() [SPACE]" : "MODE: DrawTexture() [SPACE]", 10, 45, 10, useBatch? DARKGREEN : MAROON);
+
             DrawFPS(10, 10);
 
         EndDrawing();
@@ -115,6 +138,8 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     free(bunnies);              // Unload bunnies data array
+    free(bunniesDest);          // Unload bunnies destination rectangles array
+    free(bunniesTint);          // Unload bunnies tint colors array
 
     UnloadTexture(texBunny);    // Unload bunny texture
 
@@ -62,6 +62,10 @@
 #define SUPPORT_SCREEN_CAPTURE          1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 #define SUPPORT_GIF_RECORDING           1
+// Support asynchronous screen capture, pixels readback retrieved a few frames later and encoded on a background thread
+// NOTE: Used by TakeScreenshotAsync(), F12 screen capture and gif recording, TakeScreenshot() is always synchronous
+// Readback falls back to synchronous mode if not supported (OpenGL 1.1, ES 2.0, WebGL)
+#define SUPPORT_ASYNC_SCREEN_CAPTURE    1
 // Support CompressData() and DecompressData() functions
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
@@ -70,6 +74,10 @@
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
 //#define SUPPORT_CUSTOM_FRAME_CONTROL    1
+// Support shader program binary cache: shader programs loaded from code are stored on disk after compilation
+// and loaded from binary on next program executions, if supported by OpenGL driver (OpenGL 4.1 or GL_ARB_get_program_binary, OpenGL ES 3.0)
+// NOTE: Cache files are invalidated automatically when shader code or GPU driver changes
+//#define SUPPORT_SHADER_BINARY_CACHE     1
 
 // rcore: Configuration values
 //------------------------------------------------------------------------------------
@@ -90,6 +98,11 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define SHADER_BINARY_CACHE_PATH  "shadercache"     // Shader program binary cache directory (relative to storage base path)
+
+#define MAX_CAPTURE_JOBS               16       // Maximum number of screen capture jobs pending encoding (asynchronous screen capture)
+#define MAX_CAPTURE_READBACK_FRAMES     3       // Maximum number of frames waiting for a screen capture readback before blocking
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -100,6 +113,9 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Enable GPU timer queries for frame statistics (only available on OpenGL 3.3+)
+//#define RLGL_ENABLE_GPU_TIMERS                 1
+
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
@@ -150,6 +166,11 @@
 // rshapes: Configuration values
 //------------------------------------------------------------------------------------
 #define SPLINE_SEGMENT_DIVISIONS       24       // Spline segments subdivisions
+#define SPLINE_FLATTEN_TOLERANCE    0.25f       // Spline path maximum flattening error in screen pixels, adaptive subdivision
+#define SPLINE_MITER_LIMIT           4.0f       // Spline path miter joins limit (miter length/half thickness), bevel used over limit
+#define SMOOTH_CIRCLE_ERROR_RATE     0.5f       // Circle maximum error in screen pixels, used to calculate circles segments
+#define MAX_CIRCLE_SEGMENTS           512       // Maximum number of segments for circles, size of unit circle tables
+#define MAX_CIRCLE_TABLES               4       // Maximum number of unit circle tables cached
 
 
 //------------------------------------------------------------------------------------
@@ -180,6 +201,11 @@
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
 
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define MAX_RENDER_TEXTURE_POOL_SIZE   32       // Maximum number of render textures kept in pool: AcquireRenderTexture()
+#define MAX_MANAGED_TEXTURES          256       // Maximum number of textures with managed residency: LoadTextureManaged()
+#define MANAGED_TEXTURE_EVICT_SCALE     8       // Evicted managed textures resolution divisor, low resolution version kept in VRAM
 
 //------------------------------------------------------------------------------------
 // Module: rtext - Configuration Flags
@@ -191,6 +217,8 @@
 #define SUPPORT_FILEFORMAT_TTF          1
 #define SUPPORT_FILEFORMAT_FNT          1
 //#define SUPPORT_FILEFORMAT_BDF          1
+// Binary font file format (.rfnt): glyphs, kerning and atlas pixel data, loaded without glyphs rasterization [ExportFont()]
+#define SUPPORT_FILEFORMAT_RFNT         1
 
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
@@ -201,11 +229,22 @@
 // drawing text and shapes with a single draw call [SetShapesTexture()].
 #define SUPPORT_FONT_ATLAS_WHITE_REC    1
 
+// Load TTF font kerning pairs for loaded glyphs [LoadFontEx()], applied by DrawTextEx(), MeasureTextEx() and text layouts
+#define SUPPORT_FONT_KERNING            1
+
+// Rasterize TTF font glyphs on multiple threads [LoadFontData()], result is the same as single thread rasterization
+// NOTE: If threading is not available (i.e. PLATFORM_WEB without pthreads), glyphs are rasterized on calling thread
+#define SUPPORT_FONT_PARALLEL_LOADING   1
+
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
+#define MAX_DYNAMIC_FONTS               8       // Maximum number of dynamic fonts loaded: LoadFontDynamic()
+#define MAX_DYNAMIC_FONT_PAGES          4       // Maximum number of atlas pages per dynamic font, least recently used glyphs evicted when full
+#define DYNAMIC_FONT_PAGE_SIZE       1024       // Dynamic font atlas page size in pixels (width and height)
+#define MAX_FONT_LOADING_THREADS       16       // Maximum number of threads to rasterize font glyphs: LoadFontData()
 
 
 //------------------------------------------------------------------------------------
@@ -256,6 +295,9 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Track loaded resources (textures, render textures, meshes, shaders, fonts, sounds, music) memory
+// NOTE: Required by GetResourceMemory(), GetLargestResources(), ExportResourceRegistry()
+#define SUPPORT_RESOURCE_REGISTRY       1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
@@ -202,6 +202,10 @@ typedef struct tagBITMAPINFOHEADER {
     #ifndef RL_FREE
         #define RL_FREE(ptr)            free(ptr)
     #endif
+
+    // Resource registry not available
+    #define REGISTER_RESOURCE(type, key, id, format, gpuSize, cpuSize, source) (void)0
+    #define UNREGISTER_RESOURCE(type, key) (void)0
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -957,6 +961,8 @@ Sound LoadSoundFromWave(Wave wave)
         sound.stream.sampleSize = 32;
         sound.stream.channels = AUDIO_DEVICE_CHANNELS;
         sound.stream.buffer = audioBuffer;
+
+        REGISTER_RESOURCE(RESOURCE_SOUND, (unsigned long long)(size_t)audioBuffer, 0, 0, 0, audioBuffer->sizeInFrames*AUDIO_DEVICE_CHANNELS*ma_get_bytes_per_sample(AUDIO_DEVICE_FORMAT), "LoadSound");
     }
 
     return sound;
@@ -1017,6 +1023,7 @@ void UnloadWave(Wave wave)
 // Unload sound
 void UnloadSound(Sound sound)
 {
+    UNREGISTER_RESOURCE(RESOURCE_SOUND, (unsigned long long)(size_t)sound.stream.buffer);
     UnloadAudioBuffer(sound.stream.buffer);
     //TRACELOG(LOG_INFO, "SOUND: Unloaded sound data from RAM");
 }
@@ -1508,6 +1515,9 @@ Music LoadMusicStream(const char *fileName)
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+        // NOTE: Only audio stream buffer is tracked, decoder context memory is not considered
+        REGISTER_RESOURCE(RESOURCE_MUSIC, (unsigned long long)(size_t)music.stream.buffer, 0, 0, 0, music.stream.buffer->sizeInFrames*music.stream.channels*(music.stream.sampleSize/8), "LoadMusicStream");
     }
 
     return music;
@@ -1719,6 +1729,9 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+        // NOTE: Only audio stream buffer is tracked, decoder context memory is not considered
+        REGISTER_RESOURCE(RESOURCE_MUSIC, (unsigned long long)(size_t)music.stream.buffer, 0, 0, 0, music.stream.buffer->sizeInFrames*music.stream.channels*(music.stream.sampleSize/8), "LoadMusicStreamFromMemory");
     }
 
     return music;
@@ -1737,6 +1750,7 @@ bool IsMusicReady(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+    UNREGISTER_RESOURCE(RESOURCE_MUSIC, (unsigned long long)(size_t)music.stream.buffer);
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
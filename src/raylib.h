@@ -287,6 +287,12 @@ typedef struct RenderTexture {
 // RenderTexture2D, same as RenderTexture
 typedef RenderTexture RenderTexture2D;
 
+// TextureStream, texture updated through a ring of pixel buffers
+typedef struct TextureStream {
+    Texture texture;        // Texture updated by stream
+    void *buffers;          // Stream pixel buffers data (rlgl internal)
+} TextureStream;
+
 // NPatchInfo, n-patch layout info
 typedef struct NPatchInfo {
     Rectangle source;       // Texture source rectangle
@@ -306,6 +312,13 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// GlyphKerning, kerning pair between two glyphs
+typedef struct GlyphKerning {
+    unsigned short first;   // First glyph index in font
+    unsigned short second;  // Second glyph index in font
+    float advance;          // Advance adjustment between glyphs (for font base size)
+} GlyphKerning;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -314,8 +327,25 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    int kerningTableSize;   // Kerning pairs hash table size (power of two, 0 for no kerning)
+    GlyphKerning *kerningTable; // Kerning pairs hash table, by glyphs indices
 } Font;
 
+// TextLayout, text glyphs quads computed once and cached for drawing
+typedef struct TextLayout {
+    Font font;              // Font used for layout (not owned)
+    char *text;             // Text laid out (copy)
+    float fontSize;         // Font size
+    float spacing;          // Characters spacing
+    float wrapWidth;        // Lines wrap width, 0 for no wrapping
+    int lineSpacing;        // Lines spacing used for layout
+    Vector2 size;           // Layout size (text bounds)
+    int glyphCount;         // Number of glyphs quads (spaces not included)
+    int *codepoints;        // Glyphs codepoints array
+    float *vertices;        // Glyphs quads vertex position (XY - 4 vertex per glyph), relative to layout origin
+    float *texcoords;       // Glyphs quads vertex texture coordinates (UV - 4 vertex per glyph)
+} TextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -360,6 +390,44 @@ typedef struct Mesh {
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
 } Mesh;
 
+// MeshBatch, meshes packed in shared vertex/index buffers, drawn with a single submission
+typedef struct MeshBatch {
+    int meshCount;          // Number of meshes packed in batch
+    int vertexCount;        // Number of vertices stored in shared buffers
+    int indexCount;         // Number of indices stored in shared buffer
+    unsigned int vaoId;     // OpenGL Vertex Array Object id
+    void *data;             // Batch buffers and meshes ranges data (internal)
+} MeshBatch;
+
+// Broadphase, 2d spatial index for rectangles and circles collision queries
+typedef struct Broadphase {
+    int proxyCount;         // Number of proxies (rectangles or circles) registered
+    float cellSize;         // Spatial hash grid cell size
+    void *data;             // Spatial hash grid and sweep-and-prune data (internal)
+} Broadphase;
+
+// PolygonMesh, simple polygon (with optional holes) triangulated and cached for drawing
+typedef struct PolygonMesh {
+    int pointCount;         // Number of points (outline followed by holes)
+    int holeCount;          // Number of holes
+    int triangleCount;      // Number of triangles
+    Vector2 *points;        // Points position array
+    int *holes;             // Holes first point index array
+    int *indices;           // Triangles points indices array (3 per triangle)
+} PolygonMesh;
+
+// SplinePath, spline flattened (adaptive subdivision) and stroked, cached for drawing
+typedef struct SplinePath {
+    int type;               // Spline type (SplineType)
+    int join;               // Stroke join type (SplineJoin)
+    float thick;            // Stroke thickness
+    float zoom;             // Zoom (screen scale) used on last flattening
+    int pointCount;         // Number of control points
+    Vector2 *points;        // Control points array
+    int vertexCount;        // Number of stroke vertex (3 per triangle)
+    float *vertices;        // Stroke triangles vertex position (XY - 2 components per vertex)
+} SplinePath;
+
 // Shader
 typedef struct Shader {
     unsigned int id;        // Shader program id
@@ -524,6 +592,17 @@ typedef struct AutomationEventList {
     AutomationEvent *events;        // Events entries
 } AutomationEventList;
 
+// ResourceInfo, loaded resource memory info (resource registry)
+typedef struct ResourceInfo {
+    int type;                       // Resource type (ResourceType)
+    unsigned int id;                // Resource OpenGL id (0 for audio resources)
+    int format;                     // Resource data format (PixelFormat for textures, 0 if not applicable)
+    int gpuSize;                    // Resource memory size in GPU (VRAM), in bytes
+    int cpuSize;                    // Resource memory size in CPU (RAM), in bytes
+    char tag[32];                   // Resource owner tag, set with SetResourceTag()
+    const char *source;             // Resource loading function
+} ResourceInfo;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -933,6 +1012,33 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Spline types, control points layout same as DrawSpline*() functions
+typedef enum {
+    SPLINE_LINEAR = 0,              // Spline linear, minimum 2 points
+    SPLINE_BASIS,                   // Spline B-Spline, minimum 4 points
+    SPLINE_CATMULLROM,              // Spline Catmull-Rom, minimum 4 points
+    SPLINE_BEZIER_QUADRATIC,        // Spline quadratic bezier, minimum 3 points: [p1, c2, p3, c4...]
+    SPLINE_BEZIER_CUBIC             // Spline cubic bezier, minimum 4 points: [p1, c2, c3, p4, c5, c6...]
+} SplineType;
+
+// Spline stroke joins
+typedef enum {
+    SPLINE_JOIN_MITER = 0,          // Spline join: miter, bevel used over miter limit
+    SPLINE_JOIN_BEVEL,              // Spline join: bevel
+    SPLINE_JOIN_ROUND               // Spline join: round, round caps at ends
+} SplineJoin;
+
+// Resource types, tracked by resource registry
+typedef enum {
+    RESOURCE_TEXTURE = 0,           // Texture, including cubemaps and texture streams (VRAM)
+    RESOURCE_RENDER_TEXTURE,        // Render texture, color and depth attachments (VRAM)
+    RESOURCE_MESH,                  // Mesh, vertex buffers (VRAM) and vertex data (RAM)
+    RESOURCE_SHADER,                // Shader, shader program (VRAM) and locations (RAM)
+    RESOURCE_FONT,                  // Font, glyphs data (RAM), font atlas tracked as texture
+    RESOURCE_SOUND,                 // Sound, audio buffer data (RAM)
+    RESOURCE_MUSIC                  // Music, audio stream buffer (RAM)
+} ResourceType;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -1044,6 +1150,7 @@ RLAPI int GetShaderLocation(Shader shader, const char *uniformName);       // Ge
 RLAPI int GetShaderLocationAttrib(Shader shader, const char *attribName);  // Get shader attribute location
 RLAPI void SetShaderValue(Shader shader, int locIndex, const void *value, int uniformType);               // Set shader uniform value
 RLAPI void SetShaderValueV(Shader shader, int locIndex, const void *value, int uniformType, int count);   // Set shader uniform value vector
+RLAPI void SetShaderValueByName(Shader shader, const char *uniformName, const void *value, int uniformType); // Set shader uniform value by uniform name
 RLAPI void SetShaderValueMatrix(Shader shader, int locIndex, Matrix mat);         // Set shader uniform value (matrix 4x4)
 RLAPI void SetShaderValueTexture(Shader shader, int locIndex, Texture2D texture); // Set shader uniform value for texture (sampler2d)
 RLAPI void UnloadShader(Shader shader);                                    // Unload shader from GPU memory (VRAM)
@@ -1081,6 +1188,7 @@ RLAPI void UnloadRandomSequence(int *sequence);                   // Unload rand
 
 // Misc. functions
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI void TakeScreenshotAsync(const char *fileName);             // Takes a screenshot of current screen asynchronously, file saved a few frames later (PNG encoded on background thread)
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1092,6 +1200,13 @@ RLAPI void *MemAlloc(unsigned int size);                          // Internal me
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
 
+// Resource registry functions
+RLAPI void SetResourceTag(const char *tag);                       // Set owner tag for resources loaded next (NULL to clear)
+RLAPI int GetResourceCount(int type);                             // Get number of loaded resources by type (-1 for all types)
+RLAPI long long GetResourceMemory(int type, bool gpu);            // Get memory size of loaded resources by type (-1 for all types), GPU (VRAM) or CPU (RAM), in bytes
+RLAPI int GetLargestResources(ResourceInfo *largest, int count);  // Get largest loaded resources (GPU + CPU memory), returns number of resources filled
+RLAPI bool ExportResourceRegistry(const char *fileName);          // Export loaded resources list and memory totals to text file, returns true on success
+
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advanced users
 RLAPI void SetTraceLogCallback(TraceLogCallback callback);         // Set custom trace log
@@ -1266,6 +1381,18 @@ RLAPI void DrawPoly(Vector2 center, int sides, float radius, float rotation, Col
 RLAPI void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Color color);          // Draw a polygon outline of n sides
 RLAPI void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, float lineThick, Color color); // Draw a polygon outline of n sides with extended parameters
 
+// Batched shapes drawing functions
+RLAPI void DrawRectanglesBatch(const Rectangle *recs, const Color *colors, int count);                   // Draw multiple color-filled rectangles, one color per rectangle
+RLAPI void DrawCirclesBatch(const Vector2 *centers, const float *radiuses, const Color *colors, int count); // Draw multiple color-filled circles, one radius and color per circle
+RLAPI void DrawLinesBatch(const Vector2 *points, const Color *colors, int count);                        // Draw multiple lines, points defined by pairs [start, end], one color per line
+RLAPI void DrawPixelsBatch(const Vector2 *positions, const Color *colors, int count);                    // Draw multiple pixels, one color per pixel
+
+// Polygon mesh functions (concave polygons with holes)
+RLAPI PolygonMesh LoadPolygonMesh(const Vector2 *points, int pointCount, const int *holeIndices, int holeCount); // Load polygon mesh, polygon outline followed by holes (optional) triangulated
+RLAPI void UnloadPolygonMesh(PolygonMesh mesh);                                                         // Unload polygon mesh data
+RLAPI void UpdatePolygonMesh(PolygonMesh *mesh, const Vector2 *points, int pointCount, const int *holeIndices, int holeCount); // Update polygon mesh points, triangulated again only if points changed
+RLAPI void DrawPolygonMesh(PolygonMesh mesh, Vector2 position, Color color);                             // Draw polygon mesh (color-filled), cached triangles
+
 // Splines drawing functions
 RLAPI void DrawSplineLinear(const Vector2 *points, int pointCount, float thick, Color color);                  // Draw spline: Linear, minimum 2 points
 RLAPI void DrawSplineBasis(const Vector2 *points, int pointCount, float thick, Color color);                   // Draw spline: B-Spline, minimum 4 points
@@ -1278,6 +1405,12 @@ RLAPI void DrawSplineSegmentCatmullRom(Vector2 p1, Vector2 p2, Vector2 p3, Vecto
 RLAPI void DrawSplineSegmentBezierQuadratic(Vector2 p1, Vector2 c2, Vector2 p3, float thick, Color color); // Draw spline segment: Quadratic Bezier, 2 points, 1 control point
 RLAPI void DrawSplineSegmentBezierCubic(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float thick, Color color); // Draw spline segment: Cubic Bezier, 2 points, 2 control points
 
+// Spline path functions (adaptive flattening, stroke cached)
+RLAPI SplinePath LoadSplinePath(int type, const Vector2 *points, int pointCount, float thick, int join);  // Load spline path, spline flattened and stroked (SplineType, SplineJoin)
+RLAPI void UnloadSplinePath(SplinePath path);                                                           // Unload spline path data
+RLAPI void UpdateSplinePath(SplinePath *path, const Vector2 *points, int pointCount, float zoom);        // Update spline path, flattened again only if points or zoom changed
+RLAPI void DrawSplinePath(SplinePath path, Color color);                                                // Draw spline path (color-filled stroke), cached triangles
+
 // Spline segment point evaluation functions, for a given t [0.0f .. 1.0f]
 RLAPI Vector2 GetSplinePointLinear(Vector2 startPos, Vector2 endPos, float t);                           // Get (evaluate) spline point: Linear
 RLAPI Vector2 GetSplinePointBasis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t);              // Get (evaluate) spline point: B-Spline
@@ -1297,6 +1430,23 @@ RLAPI bool CheckCollisionLines(Vector2 startPos1, Vector2 endPos1, Vector2 start
 RLAPI bool CheckCollisionPointLine(Vector2 point, Vector2 p1, Vector2 p2, int threshold);                // Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
 RLAPI bool CheckCollisionCircleLine(Vector2 center, float radius, Vector2 p1, Vector2 p2);               // Check if circle collides with a line created betweeen two points [p1] and [p2]
 RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);                                         // Get collision rectangle for two rectangles collision
+RLAPI int CheckCollisionPointsRec(const Vector2 *points, int pointCount, Rectangle rec, int *indices);   // Check multiple points inside rectangle, returns count, stores points indices (optional)
+RLAPI int CheckCollisionPointRecs(Vector2 point, const Rectangle *recs, int recCount, int *indices);     // Check point inside multiple rectangles, returns count, stores rectangles indices (optional)
+RLAPI int CheckCollisionPointsCircle(const Vector2 *points, int pointCount, Vector2 center, float radius, int *indices); // Check multiple points inside circle, returns count, stores points indices (optional)
+RLAPI int CheckCollisionPointsPoly(const Vector2 *points, int pointCount, const Vector2 *polyPoints, int polyPointCount, int *indices); // Check multiple points inside polygon, returns count, stores points indices (optional)
+RLAPI int CheckCollisionCirclesRec(const Vector2 *centers, const float *radiuses, int circleCount, Rectangle rec, int *indices); // Check multiple circles colliding with rectangle, returns count, stores circles indices (optional)
+
+// Broadphase collision detection functions
+RLAPI Broadphase LoadBroadphase(float cellSize, int capacity);                                           // Load broadphase spatial index, cell size similar to average proxy size
+RLAPI void UnloadBroadphase(Broadphase broadphase);                                                      // Unload broadphase spatial index
+RLAPI int AddBroadphaseRec(Broadphase *broadphase, Rectangle rec);                                       // Add rectangle proxy to broadphase, returns proxy id
+RLAPI int AddBroadphaseCircle(Broadphase *broadphase, Vector2 center, float radius);                     // Add circle proxy to broadphase, returns proxy id
+RLAPI void UpdateBroadphaseRec(Broadphase *broadphase, int id, Rectangle rec);                           // Update rectangle proxy in broadphase
+RLAPI void UpdateBroadphaseCircle(Broadphase *broadphase, int id, Vector2 center, float radius);         // Update circle proxy in broadphase
+RLAPI void RemoveBroadphaseProxy(Broadphase *broadphase, int id);                                        // Remove proxy from broadphase
+RLAPI int QueryBroadphaseRec(Broadphase broadphase, Rectangle rec, int *ids, int maxIds);                // Query proxies colliding with rectangle, returns number of proxy ids stored
+RLAPI int QueryBroadphasePoint(Broadphase broadphase, Vector2 point, int *ids, int maxIds);              // Query proxies containing point, returns number of proxy ids stored
+RLAPI int GetBroadphasePairs(Broadphase broadphase, int *pairs, int maxPairs);                           // Get colliding proxies pairs [idA, idB...], returns number of pairs stored
 
 //------------------------------------------------------------------------------------
 // Texture Loading and Drawing Functions (Module: textures)
@@ -1402,8 +1552,23 @@ RLAPI bool IsTextureReady(Texture2D texture);
 RLAPI void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
 RLAPI bool IsRenderTextureReady(RenderTexture2D target);                                                 // Check if a render texture is ready
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
+RLAPI RenderTexture2D AcquireRenderTexture(int width, int height, int format);                           // Get render texture from pool, reusing an available one with same size and format
+RLAPI void ReleaseRenderTexture(RenderTexture2D target);                                                 // Return render texture to pool, available for reuse
+RLAPI void UnloadRenderTexturePool(void);                                                                // Unload all render textures in pool from GPU memory (VRAM)
+RLAPI int GetRenderTexturePoolMemory(void);                                                              // Get render texture pool current memory size in bytes (VRAM)
+RLAPI int GetRenderTexturePoolPeakMemory(void);                                                          // Get render texture pool peak memory size in bytes (VRAM)
+RLAPI Texture2D LoadTextureManaged(const char *fileName);                                                // Load texture from file with managed residency, reloaded from file when required
+RLAPI Texture2D LoadTextureManagedFromImage(Image image);                                                // Load texture from image with managed residency, image copy kept in CPU memory (RAM)
+RLAPI void SetManagedTextureBudget(int budget);                                                          // Set managed textures memory budget in bytes (VRAM), least recently used textures are evicted
+RLAPI int GetManagedTextureMemory(void);                                                                 // Get managed textures current memory size in bytes (VRAM)
+RLAPI bool IsTextureEvicted(Texture2D texture);                                                          // Check if a managed texture is evicted (low resolution version in VRAM)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
+RLAPI TextureStream LoadTextureStream(int width, int height, int format);                                // Load texture for streaming updates through pixel buffers (VRAM)
+RLAPI bool IsTextureStreamReady(TextureStream stream);                                                   // Check if a texture stream is ready
+RLAPI void UnloadTextureStream(TextureStream stream);                                                    // Unload texture stream from GPU memory (VRAM)
+RLAPI void *BeginTextureStreamUpdate(TextureStream stream);                                              // Begin texture stream update, returns memory to write new pixel data
+RLAPI void EndTextureStreamUpdate(TextureStream stream);                                                 // End texture stream update, pixel data uploaded while rendering
 
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
@@ -1416,6 +1581,7 @@ RLAPI void DrawTextureV(Texture2D texture, Vector2 position, Color tint);
 RLAPI void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint);  // Draw a Texture2D with extended parameters
 RLAPI void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint);            // Draw a part of a texture defined by a rectangle
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
+RLAPI void DrawTextureBatch(Texture2D texture, const Rectangle *sources, const Rectangle *dests, const Vector2 *origins, const float *rotations, const Color *tints, int count); // Draw multiple parts of a texture with 'pro' parameters (optional arrays can be NULL)
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
 
 // Color/pixel related functions
@@ -1446,27 +1612,40 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize);                              // Load dynamic font from TTF/OTF file, glyphs rasterized on demand into atlas pages
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize); // Load dynamic font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI bool IsFontDynamic(Font font);                                                        // Check if a font is dynamic (glyphs rasterized on demand)
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
-RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
+RLAPI void SetFontLoadingThreads(int count);                                                // Set maximum number of threads used to rasterize font glyphs, 0 for all processor cores
+RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info (packMethod: 0-Default, 1-Skyline, 2-Skyline by height)
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
+RLAPI bool ExportFont(Font font, const char *fileName);                                     // Export font as binary file (.rfnt), loaded without glyphs rasterization, returns true on success
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
+RLAPI void DrawFrameStats(int posX, int posY);                                              // Draw render statistics of last frame (draw calls, vertices, binds, GPU time)
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions (cached glyphs quads)
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing, float wrapWidth); // Load text layout, glyphs quads computed once (wrapWidth = 0 for no wrapping)
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data
+RLAPI void UpdateTextLayout(TextLayout *layout, Font font, const char *text, float fontSize, float spacing, float wrapWidth); // Update text layout, computed again only if any input changed
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                  // Draw text layout, cached glyphs quads with a single transform
+
 // Text font info functions
 RLAPI void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
 RLAPI Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);    // Measure string size for Font
 RLAPI int GetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
 RLAPI GlyphInfo GetGlyphInfo(Font font, int codepoint);                                     // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
+RLAPI float GetGlyphKerning(Font font, int codepoint, int nextCodepoint);                   // Get kerning advance adjustment between two codepoints (for font base size)
 RLAPI Rectangle GetGlyphAtlasRec(Font font, int codepoint);                                 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
 
 // Text codepoints management functions (unicode characters)
@@ -1556,6 +1735,9 @@ RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI MeshBatch LoadMeshBatch(const Mesh *meshes, int meshCount);                            // Load mesh batch, meshes vertex data packed in shared GPU buffers
+RLAPI void UnloadMeshBatch(MeshBatch batch);                                                // Unload mesh batch from GPU memory (VRAM)
+RLAPI void DrawMeshBatch(MeshBatch batch, Material material, const int *meshIds, const Matrix *transforms, int count); // Draw batch meshes with material and transforms (multi-draw indirect if supported)
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
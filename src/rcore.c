@@ -47,6 +47,11 @@
 *       #define SUPPORT_GIF_RECORDING
 *           Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 *
+*       #define SUPPORT_ASYNC_SCREEN_CAPTURE
+*           Screen pixels readback is retrieved a few frames later (no pipeline stall) and screenshots/gif frames
+*           are encoded on a background thread, so capturing the screen does not stall the render loop
+*           NOTE: Used by TakeScreenshotAsync(), F12 screen capture and gif recording, TakeScreenshot() is always synchronous
+*
 *       #define SUPPORT_COMPRESSION_API
 *           Support CompressData() and DecompressData() functions, those functions use zlib implementation
 *           provided by stb_image and stb_image_write libraries, so, those libraries must be enabled on textures module
@@ -170,6 +175,35 @@ unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
     #include <mach-o/dyld.h>
 #endif // OSs
 
+// Platform specific threading required for asynchronous screen capture encoding
+// NOTE: If threading is not available, capture jobs are encoded on main thread at EndDrawing()
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
+        // NOTE: We declare required threading functions symbols to avoid including windows.h (kernel32.lib linkage required)
+        __declspec(dllimport) void *__stdcall CreateThread(void *lpThreadAttributes, size_t dwStackSize, unsigned long (__stdcall *lpStartAddress)(void *), void *lpParameter, unsigned long dwCreationFlags, unsigned long *lpThreadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **SRWLock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **SRWLock);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **ConditionVariable, void **SRWLock, unsigned long dwMilliseconds, unsigned long Flags);
+        __declspec(dllimport) void __stdcall WakeConditionVariable(void **ConditionVariable);
+
+        #define CAPTURE_THREAD_WIN32
+        #define CAPTURE_LOCK()          AcquireSRWLockExclusive(&capture.mutex)
+        #define CAPTURE_UNLOCK()        ReleaseSRWLockExclusive(&capture.mutex)
+        #define CAPTURE_WAIT(cond)      SleepConditionVariableSRW(&capture.cond, &capture.mutex, 0xFFFFFFFF, 0)
+        #define CAPTURE_SIGNAL(cond)    WakeConditionVariable(&capture.cond)
+    #elif !defined(_WIN32) && (!defined(PLATFORM_WEB) || defined(__EMSCRIPTEN_PTHREADS__))
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()
+
+        #define CAPTURE_THREAD_PTHREAD
+        #define CAPTURE_LOCK()          pthread_mutex_lock(&capture.mutex)
+        #define CAPTURE_UNLOCK()        pthread_mutex_unlock(&capture.mutex)
+        #define CAPTURE_WAIT(cond)      pthread_cond_wait(&capture.cond, &capture.mutex)
+        #define CAPTURE_SIGNAL(cond)    pthread_cond_signal(&capture.cond)
+    #endif
+#endif
+
 #define _CRT_INTERNAL_NONSTDC_NAMES  1
 #include <sys/stat.h>               // Required for: stat(), S_ISREG [Used in GetFileModTime(), IsFilePath()]
 
@@ -190,11 +224,13 @@ unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
     #include <direct.h>             // Required for: _getch(), _chdir()
     #define GETCWD _getcwd          // NOTE: MSDN recommends not to use getcwd(), chdir()
     #define CHDIR _chdir
+    #define MKDIR(dir) _mkdir(dir)
     #include <io.h>                 // Required for: _access() [Used in FileExists()]
 #else
     #include <unistd.h>             // Required for: getch(), chdir() (POSIX), access()
     #define GETCWD getcwd
     #define CHDIR chdir
+    #define MKDIR(dir) mkdir(dir, 0777)
 #endif
 
 //----------------------------------------------------------------------------------
@@ -247,6 +283,13 @@ unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef MAX_CAPTURE_JOBS
+    #define MAX_CAPTURE_JOBS              16        // Maximum number of screen capture jobs pending encoding
+#endif
+#ifndef MAX_CAPTURE_READBACK_FRAMES
+    #define MAX_CAPTURE_READBACK_FRAMES    3        // Maximum number of frames waiting for a screen capture readback
+#endif
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -372,6 +415,53 @@ bool gifRecording = false;           // GIF recording state
 MsfGifState gifState = { 0 };        // MSGIF context state
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+// Screen capture job type
+typedef enum {
+    CAPTURE_SCREENSHOT = 0,             // Export screen pixels to image file
+    CAPTURE_GIF_BEGIN,                  // Begin gif recording
+    CAPTURE_GIF_FRAME,                  // Add screen pixels frame to gif recording
+    CAPTURE_GIF_END                     // End gif recording and save file
+} CaptureJobType;
+
+// Screen capture job
+typedef struct CaptureJob {
+    int type;                           // Job type (CaptureJobType)
+    unsigned int requestId;             // Screen pixels readback request id (0 if not pending)
+    unsigned int frame;                 // Frame the readback was requested
+    unsigned char *data;                // Screen pixels data (RGBA)
+    int width;                          // Screen pixels width
+    int height;                         // Screen pixels height
+    int delay;                          // Gif frame delay in centiseconds
+    char fileName[512];                 // File path to save
+} CaptureJob;
+
+// Screen capture jobs queue, jobs are processed in order
+// NOTE: Indexes only increase, [head, ready) jobs are ready for encoding, [ready, tail) are waiting for readback
+typedef struct CaptureQueue {
+    CaptureJob jobs[MAX_CAPTURE_JOBS];  // Capture jobs ring buffer
+    int head;                           // Next job to be encoded (capture thread)
+    int ready;                          // Next job waiting for readback (main thread)
+    int tail;                           // Next job to be added (main thread)
+    bool closing;                       // Capture thread requested to finish
+    bool threadInit;                    // Capture thread creation has been tried
+    bool threadActive;                  // Capture thread running, jobs are encoded on it
+#if defined(CAPTURE_THREAD_WIN32)
+    void *thread;                       // Capture thread handle
+    void *mutex;                        // Queue indexes lock (SRWLOCK)
+    void *jobsReady;                    // Jobs ready for encoding condition (CONDITION_VARIABLE)
+    void *jobsDone;                     // Jobs encoded condition (CONDITION_VARIABLE)
+#elif defined(CAPTURE_THREAD_PTHREAD)
+    pthread_t thread;                   // Capture thread
+    pthread_mutex_t mutex;              // Queue indexes lock
+    pthread_cond_t jobsReady;           // Jobs ready for encoding condition
+    pthread_cond_t jobsDone;            // Jobs encoded condition
+#endif
+} CaptureQueue;
+
+static CaptureQueue capture = { 0 };    // Screen capture jobs queue
+#endif
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 // Automation events type
 typedef enum AutomationEventType {
@@ -470,6 +560,10 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+extern void UpdateManagedTextures(void);    // [Module: textures] Update managed textures residency, required once per frame
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
 
@@ -484,6 +578,12 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+static void PushCaptureJob(int type, int width, int height, int delay, const char *fileName); // Add screen capture job, requesting screen pixels readback if required
+static void UpdateCaptureQueue(bool wait);                  // Retrieve screen pixels for pending capture jobs and encode ready jobs
+static void CloseCaptureQueue(void);                        // Encode all pending capture jobs and finish capture thread
+#endif
+
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -682,6 +782,10 @@ void InitWindow(int width, int height, const char *title)
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    CloseCaptureQueue();        // Encode pending screen captures (requires OpenGL context)
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
@@ -695,8 +799,16 @@ void CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UnloadRenderTexturePool();  // WARNING: Module required: rtextures
+#endif
+
     rlglClose();                // De-init rlgl
 
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+    UnloadResourceRegistry();   // Unload resource registry
+#endif
+
     // De-initialize platform
     //--------------------------------------------------------------
     ClosePlatform();
@@ -840,6 +952,8 @@ void BeginDrawing(void)
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 
+    rlBeginGpuTimer(RL_GPU_TIMER_FRAME);    // Begin GPU frame time measure (if enabled)
+
     //rlTranslatef(0.375, 0.375, 0);    // HACK to have 2D pixel-perfect drawing on OpenGL 1.1
                                         // NOTE: Not required with OpenGL 3.3+
 }
@@ -861,20 +975,27 @@ void EndDrawing(void)
         // NOTE: We record one gif frame depending on the desired gif framerate
         if (gifFrameCounter > 1000/GIF_RECORD_FRAMERATE)
         {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-
             #ifndef GIF_RECORD_BITRATE
             #define GIF_RECORD_BITRATE 16
             #endif
 
+            Vector2 scale = GetWindowScaleDPI();
+
+        #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+            // Request image data for the current frame (from backbuffer), frame is added to the gif recording
+            // on capture thread once readback is available, given how many frames have passed in centiseconds
+            PushCaptureJob(CAPTURE_GIF_FRAME, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), gifFrameCounter/10, NULL);
+        #else
+            // Get image data for the current frame (from backbuffer)
+            // NOTE: This process is quite slow... :(
+            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+
             // Add the frame to the gif recording, given how many frames have passed in centiseconds
             msf_gif_frame(&gifState, screenData, gifFrameCounter/10, GIF_RECORD_BITRATE, (int)((float)CORE.Window.render.width*scale.x)*4);
-            gifFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
 
             RL_FREE(screenData);    // Free image data
+        #endif
+            gifFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
         }
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
@@ -890,6 +1011,20 @@ void EndDrawing(void)
     }
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    // Retrieve available screen captures readback (no wait)
+    if (capture.tail > capture.ready) UpdateCaptureQueue(false);
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    // Reload evicted textures used on this frame and evict least recently used ones to fit budget
+    // NOTE: Required before frame counter increase by rlResetFrameStats()
+    UpdateManagedTextures();
+#endif
+
+    rlEndGpuTimer(RL_GPU_TIMER_FRAME);  // End GPU frame time measure (if enabled)
+    rlResetFrameStats();                // Store frame statistics and reset counters for next frame
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
@@ -929,10 +1064,15 @@ void EndDrawing(void)
             {
                 gifRecording = false;
 
+            #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+                // NOTE: Gif file is saved on capture thread, once all pending frames are encoded
+                PushCaptureJob(CAPTURE_GIF_END, 0, 0, 0, TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter));
+            #else
                 MsfGifResult result = msf_gif_end(&gifState);
 
                 SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
                 msf_gif_free(result);
+            #endif
 
                 TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
             }
@@ -942,7 +1082,11 @@ void EndDrawing(void)
                 gifFrameCounter = 0;
 
                 Vector2 scale = GetWindowScaleDPI();
+            #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+                PushCaptureJob(CAPTURE_GIF_BEGIN, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 0, NULL);
+            #else
                 msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+            #endif
                 screenshotCounter++;
 
                 TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
@@ -951,7 +1095,7 @@ void EndDrawing(void)
         else
 #endif  // SUPPORT_GIF_RECORDING
         {
-            TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+            TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter));
             screenshotCounter++;
         }
     }
@@ -964,6 +1108,7 @@ void EndDrawing(void)
 void BeginMode2D(Camera2D camera)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlBeginGpuTimer(RL_GPU_TIMER_MODE_2D);
 
     rlLoadIdentity();               // Reset current matrix (modelview)
 
@@ -975,6 +1120,7 @@ void BeginMode2D(Camera2D camera)
 void EndMode2D(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlEndGpuTimer(RL_GPU_TIMER_MODE_2D);
 
     rlLoadIdentity();               // Reset current matrix (modelview)
 
@@ -985,6 +1131,7 @@ void EndMode2D(void)
 void BeginMode3D(Camera camera)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlBeginGpuTimer(RL_GPU_TIMER_MODE_3D);
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPushMatrix();                 // Save previous matrix, which contains the settings for the 2d ortho projection
@@ -1024,6 +1171,7 @@ void BeginMode3D(Camera camera)
 void EndMode3D(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlEndGpuTimer(RL_GPU_TIMER_MODE_3D);
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPopMatrix();                  // Restore previous matrix (projection) from matrix stack
@@ -1040,6 +1188,7 @@ void EndMode3D(void)
 void BeginTextureMode(RenderTexture2D target)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlBeginGpuTimer(RL_GPU_TIMER_TEXTURE_MODE);
 
     rlEnableFramebuffer(target.id); // Enable render target
 
@@ -1071,6 +1220,7 @@ void BeginTextureMode(RenderTexture2D target)
 void EndTextureMode(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlEndGpuTimer(RL_GPU_TIMER_TEXTURE_MODE);
 
     rlDisableFramebuffer();         // Disable render target (fbo)
 
@@ -1276,7 +1426,73 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
 {
     Shader shader = { 0 };
 
+#if defined(SUPPORT_SHADER_BINARY_CACHE)
+    // Cache file is identified by shader code hash (64-bit FNV-1a), raylib version is also
+    // considered because default shader code is used when vsCode or fsCode are not provided
+    // NOTE: Driver changes are validated by rlgl on binary loading
+    unsigned long long hash = 14695981039346656037ull;
+    unsigned long long length = 0;
+    const char *hashTexts[4] = { RAYLIB_VERSION, (vsCode != NULL)? vsCode : "default", "#", (fsCode != NULL)? fsCode : "default" };
+
+    for (int i = 0; i < 4; i++)
+    {
+        for (int k = 0; hashTexts[i][k] != '\0'; k++)
+        {
+            hash ^= (unsigned char)hashTexts[i][k];
+            hash *= 1099511628211ull;
+            length++;
+        }
+    }
+
+    // Cache file data starts with shader code hash and length, followed by program binary data,
+    // checked on loading to avoid using a program from different shader code
+    unsigned long long cacheHeader[2] = { hash, length };
+
+    char cacheFileName[MAX_FILEPATH_LENGTH] = { 0 };
+    snprintf(cacheFileName, MAX_FILEPATH_LENGTH, "%s/%s/shader_%016llx.rsb", CORE.Storage.basePath, SHADER_BINARY_CACHE_PATH, hash);
+
+    if (FileExists(cacheFileName))
+    {
+        int dataSize = 0;
+        unsigned char *data = LoadFileData(cacheFileName, &dataSize);
+
+        // NOTE: If shader code does not match, shader is compiled from code and cache file replaced
+        if ((data != NULL) && (dataSize > (int)sizeof(cacheHeader)) && (memcmp(data, cacheHeader, sizeof(cacheHeader)) == 0))
+        {
+            shader.id = rlLoadShaderProgramBinary(data + sizeof(cacheHeader), dataSize - (int)sizeof(cacheHeader));
+        }
+        else TRACELOG(LOG_WARNING, "SHADER: [%s] Cache file does not match shader code", cacheFileName);
+
+        UnloadFileData(data);
+    }
+
+    if (shader.id == 0)
+    {
+        shader.id = rlLoadShaderCode(vsCode, fsCode);
+
+        // Store compiled program binary for next executions
+        // NOTE: Default shader id is returned on compilation/linking failure, it is never cached
+        int dataSize = 0;
+        unsigned char *data = ((shader.id > 0) && (shader.id != rlGetShaderIdDefault()))? rlGetShaderProgramBinary(shader.id, &dataSize) : NULL;
+
+        if (data != NULL)
+        {
+            const char *cachePath = TextFormat("%s/%s", CORE.Storage.basePath, SHADER_BINARY_CACHE_PATH);
+            if (!DirectoryExists(cachePath)) MKDIR(cachePath);
+
+            unsigned char *cacheData = (unsigned char *)RL_MALLOC(sizeof(cacheHeader) + dataSize);
+            memcpy(cacheData, cacheHeader, sizeof(cacheHeader));
+            memcpy(cacheData + sizeof(cacheHeader), data, dataSize);
+
+            SaveFileData(cacheFileName, cacheData, (int)sizeof(cacheHeader) + dataSize);
+
+            RL_FREE(cacheData);
+            RL_FREE(data);
+        }
+    }
+#else
     shader.id = rlLoadShaderCode(vsCode, fsCode);
+#endif
 
     // After shader loading, we TRY to set default location names
     if (shader.id > 0)
@@ -1316,6 +1532,9 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
         shader.locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
         shader.locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
         shader.locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+
+        // NOTE: Shader program GPU memory is driver dependant, not tracked
+        REGISTER_RESOURCE(RESOURCE_SHADER, shader.id, shader.id, 0, 0, RL_MAX_SHADER_LOCATIONS*sizeof(int), "LoadShader");
     }
 
     return shader;
@@ -1358,6 +1577,7 @@ void UnloadShader(Shader shader)
 {
     if (shader.id != rlGetShaderIdDefault())
     {
+        UNREGISTER_RESOURCE(RESOURCE_SHADER, shader.id);
         rlUnloadShaderProgram(shader.id);
 
         // NOTE: If shader loading failed, it should be 0
@@ -1366,6 +1586,7 @@ void UnloadShader(Shader shader)
 }
 
 // Get shader uniform location
+// NOTE: Shader active uniforms locations are stored by rlgl on shader loading, it's just a hash table lookup
 int GetShaderLocation(Shader shader, const char *uniformName)
 {
     return rlGetLocationUniform(shader.id, uniformName);
@@ -1394,6 +1615,12 @@ void SetShaderValueV(Shader shader, int locIndex, const void *value, int uniform
     }
 }
 
+// Set shader uniform value by uniform name
+void SetShaderValueByName(Shader shader, const char *uniformName, const void *value, int uniformType)
+{
+    SetShaderValueV(shader, rlGetLocationUniform(shader.id, uniformName), value, uniformType, 1);
+}
+
 // Set shader uniform value (matrix 4x4)
 void SetShaderValueMatrix(Shader shader, int locIndex, Matrix mat)
 {
@@ -1813,12 +2040,13 @@ void TakeScreenshot(const char *fileName)
     if (strchr(fileName, '\'') != NULL) { TRACELOG(LOG_WARNING, "SYSTEM: Provided fileName could be potentially malicious, avoid [\'] character"); return; }
 
     Vector2 scale = GetWindowScaleDPI();
-    unsigned char *imgData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-    Image image = { imgData, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
     char path[512] = { 0 };
     strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, GetFileName(fileName)));
 
+    unsigned char *imgData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+    Image image = { imgData, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+
     ExportImage(image, path);           // WARNING: Module required: rtextures
     RL_FREE(imgData);
 
@@ -1829,6 +2057,28 @@ void TakeScreenshot(const char *fileName)
 #endif
 }
 
+// Takes a screenshot of current screen asynchronously, image file is saved a few frames later
+// NOTE: Screen pixels are retrieved a few frames later and PNG image is encoded on capture thread,
+// other file formats (or async capture not supported) fallback to TakeScreenshot()
+void TakeScreenshotAsync(const char *fileName)
+{
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (!IsFileExtension(fileName, ".png")) { TakeScreenshot(fileName); return; }
+
+    // Security check to (partially) avoid malicious code
+    if (strchr(fileName, '\'') != NULL) { TRACELOG(LOG_WARNING, "SYSTEM: Provided fileName could be potentially malicious, avoid [\'] character"); return; }
+
+    Vector2 scale = GetWindowScaleDPI();
+
+    char path[512] = { 0 };
+    strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, GetFileName(fileName)));
+
+    PushCaptureJob(CAPTURE_SCREENSHOT, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 0, path);
+#else
+    TakeScreenshot(fileName);
+#endif
+}
+
 // Setup window configuration flags (view FLAGS)
 // NOTE: This function is expected to be called before window creation,
 // because it sets up some flags for the window creation process
@@ -3638,6 +3888,227 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+// Process screen capture job: export image file or encode gif frame
+// WARNING: Usually called from capture thread, only thread-safe functions should be used,
+// screenshot file format is resolved on main thread and image is always encoded as PNG
+static void ProcessCaptureJob(CaptureJob *job)
+{
+    switch (job->type)
+    {
+        case CAPTURE_SCREENSHOT:
+        {
+        #if defined(SUPPORT_MODULE_RTEXTURES)
+            Image image = { job->data, job->width, job->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+            bool success = false;
+
+            // NOTE: ExportImageToMemory() does not use any internal static buffer
+            int fileDataSize = 0;
+            unsigned char *fileData = ExportImageToMemory(image, ".png", &fileDataSize);
+
+            if (fileData != NULL)
+            {
+                success = SaveFileData(job->fileName, fileData, fileDataSize);
+                RL_FREE(fileData);
+            }
+
+            if (success) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", job->fileName);
+            else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", job->fileName);
+        #endif
+        } break;
+    #if defined(SUPPORT_GIF_RECORDING)
+        case CAPTURE_GIF_BEGIN: msf_gif_begin(&gifState, job->width, job->height); break;
+        case CAPTURE_GIF_FRAME:
+        {
+            if (job->data != NULL) msf_gif_frame(&gifState, job->data, job->delay, GIF_RECORD_BITRATE, job->width*4);
+        } break;
+        case CAPTURE_GIF_END:
+        {
+            MsfGifResult result = msf_gif_end(&gifState);
+
+            SaveFileData(job->fileName, result.data, (unsigned int)result.dataSize);
+            msf_gif_free(result);
+        } break;
+    #endif
+        default: break;
+    }
+
+    RL_FREE(job->data);
+    job->data = NULL;
+}
+
+#if defined(CAPTURE_THREAD_WIN32) || defined(CAPTURE_THREAD_PTHREAD)
+// Capture thread loop, encode capture jobs as they get ready, until closing requested
+static void CaptureThreadLoop(void)
+{
+    CAPTURE_LOCK();
+
+    while (true)
+    {
+        while ((capture.head == capture.ready) && !capture.closing) CAPTURE_WAIT(jobsReady);
+
+        if (capture.head == capture.ready) break;   // Closing requested and no more jobs ready
+
+        CaptureJob *job = &capture.jobs[capture.head%MAX_CAPTURE_JOBS];
+
+        // NOTE: Job is not accessed by main thread until head is moved forward
+        CAPTURE_UNLOCK();
+        ProcessCaptureJob(job);
+        CAPTURE_LOCK();
+
+        capture.head++;
+        CAPTURE_SIGNAL(jobsDone);
+    }
+
+    CAPTURE_UNLOCK();
+}
+#endif
+
+#if defined(CAPTURE_THREAD_WIN32)
+static unsigned long __stdcall CaptureThread(void *arg) { CaptureThreadLoop(); return 0; }
+#elif defined(CAPTURE_THREAD_PTHREAD)
+static void *CaptureThread(void *arg) { CaptureThreadLoop(); return NULL; }
+#endif
+
+// Add screen capture job, requesting screen pixels readback if required
+// NOTE: Capture thread is created on first job added
+static void PushCaptureJob(int type, int width, int height, int delay, const char *fileName)
+{
+    if (!capture.threadInit)
+    {
+        capture.threadInit = true;
+
+    #if defined(CAPTURE_THREAD_WIN32)
+        capture.thread = CreateThread(NULL, 0, CaptureThread, NULL, 0, NULL);
+        capture.threadActive = (capture.thread != NULL);
+    #elif defined(CAPTURE_THREAD_PTHREAD)
+        pthread_mutex_init(&capture.mutex, NULL);
+        pthread_cond_init(&capture.jobsReady, NULL);
+        pthread_cond_init(&capture.jobsDone, NULL);
+        capture.threadActive = (pthread_create(&capture.thread, NULL, CaptureThread, NULL) == 0);
+    #endif
+
+        if (capture.threadActive) TRACELOG(LOG_INFO, "SYSTEM: Screen capture thread created successfully");
+        else TRACELOG(LOG_WARNING, "SYSTEM: Screen capture thread not available, capture encoded on main thread");
+    }
+
+    // Check queue capacity, wait for pending jobs if required
+    int pending = 0;
+    if (capture.threadActive)
+    {
+        CAPTURE_LOCK();
+        pending = capture.tail - capture.head;
+        CAPTURE_UNLOCK();
+    }
+    else pending = capture.tail - capture.head;
+
+    if (pending >= MAX_CAPTURE_JOBS) UpdateCaptureQueue(true);
+
+    CaptureJob *job = &capture.jobs[capture.tail%MAX_CAPTURE_JOBS];
+    memset(job, 0, sizeof(CaptureJob));
+
+    job->type = type;
+    job->width = width;
+    job->height = height;
+    job->delay = delay;
+    if (fileName != NULL) strncpy(job->fileName, fileName, sizeof(job->fileName) - 1);
+
+    if ((type == CAPTURE_SCREENSHOT) || (type == CAPTURE_GIF_FRAME))
+    {
+        job->requestId = rlReadScreenPixelsAsync(width, height);
+        job->frame = CORE.Time.frameCounter;
+
+        // Asynchronous readback not supported, read pixels right now
+        if (job->requestId == 0) job->data = rlReadScreenPixels(width, height);
+    }
+
+    capture.tail++;
+}
+
+// Retrieve screen pixels for pending capture jobs and encode ready jobs
+// NOTE: If wait is requested, blocks until all jobs are encoded
+static void UpdateCaptureQueue(bool wait)
+{
+    int ready = capture.ready;
+
+    // Jobs are processed in order, first job waiting for readback stops the process
+    while (ready < capture.tail)
+    {
+        CaptureJob *job = &capture.jobs[ready%MAX_CAPTURE_JOBS];
+
+        if (job->requestId > 0)
+        {
+            // NOTE: Readback waiting for too long is always retrieved, blocking if required
+            bool waitReadback = wait || ((CORE.Time.frameCounter - job->frame) >= MAX_CAPTURE_READBACK_FRAMES);
+
+            job->data = rlGetScreenPixelsAsync(job->requestId, waitReadback);
+            if ((job->data == NULL) && !waitReadback) break;
+
+            job->requestId = 0;
+        }
+
+        ready++;
+    }
+
+    if (capture.threadActive)
+    {
+        CAPTURE_LOCK();
+
+        if (ready != capture.ready)
+        {
+            capture.ready = ready;
+            CAPTURE_SIGNAL(jobsReady);
+        }
+
+        if (wait) while (capture.head < capture.tail) CAPTURE_WAIT(jobsDone);
+
+        CAPTURE_UNLOCK();
+    }
+    else
+    {
+        capture.ready = ready;
+
+        while (capture.head < capture.ready)
+        {
+            ProcessCaptureJob(&capture.jobs[capture.head%MAX_CAPTURE_JOBS]);
+            capture.head++;
+        }
+    }
+}
+
+// Encode all pending capture jobs and finish capture thread
+static void CloseCaptureQueue(void)
+{
+    UpdateCaptureQueue(true);
+
+    if (capture.threadActive)
+    {
+        CAPTURE_LOCK();
+        capture.closing = true;
+        CAPTURE_SIGNAL(jobsReady);
+        CAPTURE_UNLOCK();
+
+    #if defined(CAPTURE_THREAD_WIN32)
+        WaitForSingleObject(capture.thread, 0xFFFFFFFF);    // INFINITE
+        CloseHandle(capture.thread);
+    #elif defined(CAPTURE_THREAD_PTHREAD)
+        pthread_join(capture.thread, NULL);
+    #endif
+    }
+
+#if defined(CAPTURE_THREAD_PTHREAD)
+    if (capture.threadInit)
+    {
+        pthread_cond_destroy(&capture.jobsDone);
+        pthread_cond_destroy(&capture.jobsReady);
+        pthread_mutex_destroy(&capture.mutex);
+    }
+#endif
+
+    memset(&capture, 0, sizeof(CaptureQueue));
+}
+#endif
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
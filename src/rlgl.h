@@ -46,6 +46,14 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_ENABLE_GPU_TIMERS
+*           Enable GPU timer queries for rlBeginGpuTimer()/rlEndGpuTimer() scopes (only available on OpenGL 3.3+)
+*           Timings are retrieved with some frames of latency to avoid stalling the pipeline
+*
+*       #define RLGL_DISABLE_SIMD
+*           Disable SSE/NEON vertex transform on bulk vertex submission (rlVertex2fv(), rlVertex3fv()...)
+*           SIMD path is enabled by default when compiler targets support it
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
@@ -58,6 +66,10 @@
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
+*       #define RL_MAX_GPU_TIMER_QUERIES             32    // Maximum number of GPU timer scopes measured per frame
+*       #define RL_GPU_TIMER_FRAMES_LATENCY           3    // Number of frames to wait before reading GPU timer results
+*       #define RL_READBACK_BUFFERS                   3    // Number of pixel buffers for asynchronous screen readback (requests in flight)
+*       #define RL_TEXTURE_STREAM_BUFFERS             3    // Number of pixel buffers per texture stream (uploads in flight)
 *
 *       When loading a shader, the following vertex attributes and uniform
 *       location names are tried to be set automatically:
@@ -68,6 +80,7 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID       "vertexDrawId"      // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_DRAWID
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -237,6 +250,24 @@
     #define RL_CULL_DISTANCE_FAR                1000.0      // Default far cull distance
 #endif
 
+// GPU timer queries
+#ifndef RL_MAX_GPU_TIMER_QUERIES
+    #define RL_MAX_GPU_TIMER_QUERIES                32      // Maximum number of GPU timer scopes measured per frame
+#endif
+#ifndef RL_GPU_TIMER_FRAMES_LATENCY
+    #define RL_GPU_TIMER_FRAMES_LATENCY              3      // Number of frames to wait before reading GPU timer results
+#endif
+
+// Asynchronous screen readback
+#ifndef RL_READBACK_BUFFERS
+    #define RL_READBACK_BUFFERS                      3      // Number of pixel buffers for asynchronous screen readback (requests in flight)
+#endif
+
+// Texture streaming
+#ifndef RL_TEXTURE_STREAM_BUFFERS
+    #define RL_TEXTURE_STREAM_BUFFERS                3      // Number of pixel buffers per texture stream (uploads in flight)
+#endif
+
 // Texture parameters (equivalent to OpenGL defines)
 #define RL_TEXTURE_WRAP_S                       0x2802      // GL_TEXTURE_WRAP_S
 #define RL_TEXTURE_WRAP_T                       0x2803      // GL_TEXTURE_WRAP_T
@@ -341,6 +372,9 @@
 #ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2 5
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_DRAWID
+    #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_DRAWID    6
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -408,6 +442,41 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// rlStaticBatch type, geometry recorded from render batch and stored in GPU
+// NOTE: RL_QUADS are converted to RL_TRIANGLES on recording, draws do not require vertex alignment
+typedef struct rlStaticBatch {
+    int vertexCount;            // Number of vertex stored in GPU buffers
+    int drawCount;              // Number of draw calls (by primitive mode and texture changes)
+    rlDrawCall *draws;          // Draw calls array, consecutive vertex ranges
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+} rlStaticBatch;
+
+// rlTextureStream type, texture updated through a ring of pixel unpack buffers
+// NOTE: Texture upload from buffer is asynchronous, it overlaps with rendering
+typedef struct rlTextureStream {
+    unsigned int textureId;     // Texture updated by stream
+    int width;                  // Texture width
+    int height;                 // Texture height
+    int format;                 // Texture pixel format (PixelFormat type)
+    int size;                   // Pixel data size in bytes
+    int current;                // Current buffer index
+    unsigned int pboId[RL_TEXTURE_STREAM_BUFFERS];  // OpenGL pixel unpack buffers id
+    void *fence[RL_TEXTURE_STREAM_BUFFERS];         // Fences signaled when upload from buffer completes (GLsync)
+    void *mapped;               // Buffer memory currently mapped for writing (NULL if not mapped)
+    unsigned char *data;        // Pixel data in CPU memory (pixel buffers not supported)
+} rlTextureStream;
+
+// rlDrawElementsCommand type, indexed draw command
+// NOTE: Same layout required by glMultiDrawElementsIndirect(), indices type is unsigned int
+typedef struct rlDrawElementsCommand {
+    unsigned int count;         // Number of indices to draw
+    unsigned int instanceCount; // Number of instances to draw
+    unsigned int firstIndex;    // First index to draw in elements buffer
+    int baseVertex;             // Value added to indices before fetching vertex data
+    unsigned int baseInstance;  // First instance, used to fetch instanced vertex attributes
+} rlDrawElementsCommand;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -571,6 +640,30 @@ typedef enum {
     RL_CULL_FACE_BACK
 } rlCullMode;
 
+// GPU timer scopes
+// NOTE: Multiple begin/end pairs of the same scope in one frame are accumulated
+typedef enum {
+    RL_GPU_TIMER_FRAME = 0,             // GPU timer scope: frame, BeginDrawing()/EndDrawing()
+    RL_GPU_TIMER_MODE_2D,               // GPU timer scope: BeginMode2D()/EndMode2D()
+    RL_GPU_TIMER_MODE_3D,               // GPU timer scope: BeginMode3D()/EndMode3D()
+    RL_GPU_TIMER_TEXTURE_MODE,          // GPU timer scope: BeginTextureMode()/EndTextureMode()
+    RL_GPU_TIMER_CUSTOM                 // GPU timer scope: user defined
+} rlGpuTimerScope;
+
+#define RL_GPU_TIMER_SCOPE_COUNT        5   // Number of GPU timer scopes available
+
+// Frame statistics, render work submitted to the GPU by rlgl during one frame
+typedef struct rlFrameStats {
+    unsigned int drawCalls;             // Number of draw calls (glDrawArrays*(), glDrawElements*())
+    unsigned int batchFlushes;          // Number of render batch flushes with vertex data (rlDrawRenderBatch())
+    unsigned int vertexCount;           // Number of vertices submitted by draw calls (instances considered)
+    unsigned int textureBinds;          // Number of textures bound for drawing
+    unsigned int textureSwitches;       // Number of texture changes requested to render batch (rlSetTexture())
+    unsigned int shaderSwitches;        // Number of shader programs enabled for drawing
+    unsigned int bufferBytes;           // Number of bytes uploaded to GPU buffers
+    float gpuTime[RL_GPU_TIMER_SCOPE_COUNT]; // GPU time per scope in milliseconds (requires RLGL_ENABLE_GPU_TIMERS)
+} rlFrameStats;
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -607,6 +700,10 @@ RLAPI void rlNormal3f(float x, float y, float z);       // Define one vertex (no
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);        // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlVertex2fv(const float *vertices, int count); // Define multiple vertex (position) - 2 float per vertex, current texcoord/normal/color
+RLAPI void rlVertex3fv(const float *vertices, int count); // Define multiple vertex (position) - 3 float per vertex, current texcoord/normal/color
+RLAPI void rlVertexTexCoord2fv(const float *vertices, const float *texcoords, int count); // Define multiple vertex (position, texcoord) - 2 float + 2 float per vertex
+RLAPI void rlVertexColor2fv(const float *vertices, const float *texcoords, const unsigned char *colors, int count); // Define multiple vertex (position, texcoord, color) - 2 float + 2 float + 4 byte per vertex, texcoords optional
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -680,6 +777,7 @@ RLAPI void rlCheckErrors(void);                         // Check and log OpenGL
 RLAPI void rlSetBlendMode(int mode);                    // Set blending mode
 RLAPI void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation); // Set blending mode factor and equation (using OpenGL factors)
 RLAPI void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha, int glEqRGB, int glEqAlpha); // Set blending mode factors and equations separately (using OpenGL factors)
+RLAPI void rlInvalidateStateCache(void);                // Invalidate internal OpenGL state cache (required after external OpenGL calls)
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - rlgl functionality
@@ -708,8 +806,25 @@ RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active rende
 RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
 
+// Static batch management
+// NOTE: Draw calls issued between rlBeginStaticBatch() and rlEndStaticBatch() are recorded instead of drawn,
+// recorded geometry is uploaded once to GPU and it can be drawn multiple times, no CPU processing required
+RLAPI void rlBeginStaticBatch(void);                    // Begin recording render batch data into a static batch
+RLAPI rlStaticBatch rlEndStaticBatch(void);             // End recording and load static batch into GPU
+RLAPI void rlDrawStaticBatch(rlStaticBatch batch, Matrix transform); // Draw static batch with transform, using current shader and matrices
+RLAPI void rlUnloadStaticBatch(rlStaticBatch batch);    // Unload static batch data from CPU and GPU
+
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// Frame statistics and GPU timers
+RLAPI rlFrameStats rlGetFrameStats(void);               // Get render statistics of last completed frame
+RLAPI void rlResetFrameStats(void);                     // Store current frame statistics and reset counters for next frame
+RLAPI void rlBeginGpuTimer(int scope);                  // Begin GPU timer scope (requires RLGL_ENABLE_GPU_TIMERS)
+RLAPI void rlEndGpuTimer(int scope);                    // End GPU timer scope
+RLAPI unsigned int rlGetFrameCounter(void);             // Get current frame counter (increased by rlResetFrameStats())
+RLAPI void rlTrackTextureUsage(unsigned int id);        // Track texture usage, frame texture was last set for drawing
+RLAPI unsigned int rlGetTextureLastFrame(unsigned int id); // Get frame texture was last set for drawing (0 if not used or not tracked)
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -727,18 +842,28 @@ RLAPI void rlDrawVertexArray(int offset, int count);    // Draw vertex array (cu
 RLAPI void rlDrawVertexArrayElements(int offset, int count, const void *buffer); // Draw vertex array elements
 RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances); // Draw vertex array (currently active vao) with instancing
 RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances); // Draw vertex array elements with instancing
+RLAPI void rlDrawVertexArrayElementsIndirect(const rlDrawElementsCommand *commands, int count); // Draw vertex array elements commands (unsigned int indices), multi-draw indirect if supported
+RLAPI bool rlIsMultiDrawIndirectSupported(void);       // Check if multi-draw indirect is supported (requires OpenGL 4.3)
 
 // Textures management
 RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount); // Load texture data
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer); // Load depth texture/renderbuffer (to be attached to fbo)
 RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format); // Load texture cubemap data
 RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture with new data on GPU
+RLAPI void rlReloadTexture(unsigned int id, const void *data, int width, int height, int format, int mipmapCount); // Reload texture data on GPU, size and format can change (same texture id)
+RLAPI rlTextureStream rlLoadTextureStream(unsigned int id, int width, int height, int format); // Load texture stream for texture updates through pixel buffers
+RLAPI void rlUnloadTextureStream(rlTextureStream *stream);                // Unload texture stream pixel buffers (texture not unloaded)
+RLAPI void *rlMapTextureStream(rlTextureStream *stream);                  // Map next texture stream buffer, returns memory to write pixel data
+RLAPI void rlUnmapTextureStream(rlTextureStream *stream);                 // Unmap texture stream buffer and upload pixel data to texture (asynchronous)
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType); // Get OpenGL internal formats
+RLAPI bool rlIsTextureNPOTSupported(void);              // Check if NPOT textures are fully supported (mipmaps and repeat wrap)
 RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI unsigned int rlReadScreenPixelsAsync(int width, int height);        // Request screen pixel data readback, retrieved later (returns request id, 0 if not supported)
+RLAPI unsigned char *rlGetScreenPixelsAsync(unsigned int requestId, bool wait); // Get requested screen pixel data (NULL if not ready yet, wait to block until available)
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(void);                               // Load an empty framebuffer
@@ -751,6 +876,8 @@ RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode);
 RLAPI unsigned int rlCompileShader(const char *shaderCode, int type);           // Compile custom shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
 RLAPI unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId); // Load custom shader program
 RLAPI void rlUnloadShaderProgram(unsigned int id);                              // Unload shader program
+RLAPI unsigned char *rlGetShaderProgramBinary(unsigned int id, int *dataSize);  // Get shader program binary data (driver dependant, NULL if not supported)
+RLAPI unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int dataSize); // Load shader program from binary data (0 if not supported or driver changed)
 RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName); // Get shader location uniform
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count); // Set shader value uniform
@@ -869,6 +996,20 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
+#if !defined(RLGL_DISABLE_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>          // Required for: SSE intrinsics [Used in rlTransformVertexSpan()]
+        #define RLGL_SIMD_SSE
+        #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+            #include <emmintrin.h>      // Required for: SSE2 integer intrinsics [Used in rlFlipScreenPixels()]
+            #define RLGL_SIMD_SSE2
+        #endif
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>           // Required for: NEON intrinsics [Used in rlTransformVertexSpan()]
+        #define RLGL_SIMD_NEON
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -973,6 +1114,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID       "vertexDrawId"      // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -1002,10 +1146,53 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 #endif
 
+// OpenGL state cache
+#ifndef RL_STATE_CACHE_TEXTURE_SLOTS
+    #define RL_STATE_CACHE_TEXTURE_SLOTS        16      // Number of texture slots tracked by state cache
+#endif
+#ifndef RL_STATE_CACHE_UNIFORMS
+    #define RL_STATE_CACHE_UNIFORMS            256      // Number of uniform values tracked by state cache (power of two)
+#endif
+#define RL_STATE_UNKNOWN                0xFFFFFFFF      // Cached state not known, next state change is always issued
+
+#define RL_SHADER_BINARY_MAGIC          0x42505352      // Shader program binary data identifier ("RSPB")
+#define RL_READBACK_TIMEOUT             1000000000      // Maximum time waiting for a screen readback to complete (nanoseconds)
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+    #define GL_PROGRAM_BINARY_RETRIEVABLE_HINT  0x8257
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Uniform value tracked by state cache
+typedef struct rlUniformCache {
+    unsigned int shaderId;                  // Shader program id (0 if not used)
+    int location;                           // Uniform location
+    int size;                               // Uniform value size in bytes
+    unsigned char value[64];                // Uniform value data (up to a 4x4 float matrix)
+} rlUniformCache;
+
+// Uniform names to locations table for a shader program (hashed, open addressing)
+typedef struct rlUniformTable {
+    unsigned int shaderId;                  // Shader program id
+    int capacity;                           // Table capacity (power of two)
+    int count;                              // Number of uniform names stored
+    unsigned int *hashes;                   // Uniform name hashes (0 for empty slot)
+    int *locations;                         // Uniform locations (-1 if not available in shader)
+    char **names;                           // Uniform names
+} rlUniformTable;
+
+// Screen pixels readback buffer
+typedef struct rlReadbackBuffer {
+    unsigned int requestId;             // Readback request id using the buffer (0 if available)
+    unsigned int pboId;                 // Pixel buffer object id (GL_PIXEL_PACK_BUFFER)
+    int size;                           // Pixel buffer object size in bytes
+    int width;                          // Pixel data width
+    int height;                         // Pixel data height
+    void *fence;                        // Fence signaled once pixel data is available (GLsync)
+} rlReadbackBuffer;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
@@ -1072,11 +1259,66 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool timerQuery;                    // Timer queries support (GL_ARB_timer_query)
+        bool programBinary;                 // Shader program binary support (GL_ARB_get_program_binary)
+        bool pixelBufferSync;               // Pixel buffer objects with fence sync support (GL_ARB_pixel_buffer_object, GL_ARB_sync)
+        bool multiDrawIndirect;             // Multi-draw indirect with base instance support (GL_ARB_multi_draw_indirect, GL_ARB_base_instance)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        unsigned int shaderId;              // Shader program currently enabled
+        unsigned int vaoId;                 // Vertex array currently bound
+        unsigned int framebufferId;         // Framebuffer currently bound (read and draw)
+        unsigned int activeTextureSlot;     // Texture slot currently active
+        unsigned int textureId[RL_STATE_CACHE_TEXTURE_SLOTS];       // Texture 2D bound per texture slot
+        unsigned int cubemapId[RL_STATE_CACHE_TEXTURE_SLOTS];       // Texture cubemap bound per texture slot
+        unsigned int colorBlend;            // Color blending enabled
+        unsigned int depthTest;             // Depth test enabled
+        unsigned int depthMask;             // Depth write enabled
+        unsigned int backfaceCulling;       // Backface culling enabled
+        unsigned int scissorTest;           // Scissor test enabled
+        unsigned int cullFace;              // Face culling mode
+        unsigned int viewport[4];           // Viewport area (x, y, width, height)
+        rlUniformCache uniforms[RL_STATE_CACHE_UNIFORMS]; // Uniform values per shader program and location
+    } Cache;            // OpenGL state cache, filters redundant state changes (RL_STATE_UNKNOWN if not known)
+    struct {
+        bool active;                        // Static batch recording active, render batch is recorded instead of drawn
+        float *vertices;                    // Recorded vertex position (XYZ - 3 components per vertex)
+        float *texcoords;                   // Recorded vertex texture coordinates (UV - 2 components per vertex)
+        float *normals;                     // Recorded vertex normal (XYZ - 3 components per vertex)
+        unsigned char *colors;              // Recorded vertex colors (RGBA - 4 components per vertex)
+        int vertexCount;                    // Number of vertex recorded
+        int vertexCapacity;                 // Number of vertex allocated
+        rlDrawCall *draws;                  // Recorded draw calls
+        int drawCount;                      // Number of draw calls recorded
+        int drawCapacity;                   // Number of draw calls allocated
+    } Recording;        // Static batch recording data
+    struct {
+        rlUniformTable *tables;             // Uniform location tables, one per shader program
+        int count;                          // Number of tables loaded
+        int capacity;                       // Number of tables allocated
+        int last;                           // Last table accessed (usually accessed consecutively)
+    } UniformTables;    // Shader uniform locations by name
+    struct {
+        rlReadbackBuffer buffers[RL_READBACK_BUFFERS];  // Screen readback buffers ring
+        unsigned int counter;               // Readback requests counter, last request id
+    } Readback;         // Asynchronous screen pixels readback data
+    struct {
+        unsigned int bufferId;              // Draw commands buffer (GL_DRAW_INDIRECT_BUFFER)
+        int capacity;                       // Draw commands buffer capacity (number of commands)
+    } Indirect;         // Multi-draw indirect commands data
+#if defined(GRAPHICS_API_OPENGL_33) && defined(RLGL_ENABLE_GPU_TIMERS)
+    struct {
+        unsigned int queries[RL_GPU_TIMER_FRAMES_LATENCY][RL_MAX_GPU_TIMER_QUERIES*2];  // Timestamp queries (begin, end) for every frame in flight
+        int scopes[RL_GPU_TIMER_FRAMES_LATENCY][RL_MAX_GPU_TIMER_QUERIES];  // Scope measured by every queries pair
+        int counter[RL_GPU_TIMER_FRAMES_LATENCY];   // Number of queries pairs issued for every frame in flight
+        int openQuery[RL_GPU_TIMER_SCOPE_COUNT];    // Queries pair currently open for every scope (-1 if not open)
+        int currentFrame;                   // Current frame in flight index
+    } GpuTimer;         // GPU timer queries data
+#endif
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1089,6 +1331,13 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 static double rlCullDistanceNear = RL_CULL_DISTANCE_NEAR;
 static double rlCullDistanceFar = RL_CULL_DISTANCE_FAR;
 
+static rlFrameStats rlStatsCurrent = { 0 };     // Frame statistics being collected for current frame
+static rlFrameStats rlStatsLast = { 0 };        // Frame statistics of last completed frame
+static unsigned int rlFrameCounter = 1;         // Frames counter, increased on frame statistics reset
+
+static unsigned int *rlTextureLastFrame = NULL; // Frame every tracked texture was last set for drawing, indexed by texture id
+static unsigned int rlTextureTrackCount = 0;    // Number of texture ids tracked (greatest tracked id + 1)
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static rlglData RLGL = { 0 };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -1111,19 +1360,30 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlAppendVertexSpan(const float *vertices, int components, const float *texcoords, const unsigned char *colors, int count); // Append multiple vertex to current batch, checking batch limits
+static void rlRecordRenderBatch(rlRenderBatch *batch);  // Record render batch data into static batch
+static void rlTransformVertexSpan(float *dst, const float *src, int components, float z, int count); // Transform vertex positions by current transform matrix
+static void rlBindVertexArray(unsigned int vaoId);  // Bind vertex array, filtering redundant binds
+static bool rlCheckUniformCache(int location, const void *value, int size); // Check uniform value is already set for current shader (updates cache)
+static void rlLoadUniformTable(unsigned int shaderId);  // Load shader active uniforms locations into a table
+static void rlUnloadUniformTable(unsigned int shaderId); // Unload shader uniforms locations table
+static rlUniformTable *rlGetUniformTable(unsigned int shaderId); // Get shader uniforms locations table (NULL if not loaded)
+static int *rlFindUniformTableEntry(rlUniformTable *table, const char *uniformName, bool insert); // Find (or insert) uniform location entry by name
+static void rlClearUniformCache(unsigned int shaderId, int location, int count); // Clear cached uniform values for shader locations
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+static void rlFlipScreenPixels(unsigned char *pixels, int width, int height); // Flip screen pixel data vertically in-place (setting alpha to 255)
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+static unsigned int rlGetDriverHash(void);                          // Get hash of OpenGL driver vendor, renderer and version strings
+#endif
+static void rlBindTexture(unsigned int target, unsigned int id);    // Bind texture to active slot, filtering redundant binds
+static void rlSetCapability(unsigned int capability, bool enabled);  // Enable/disable OpenGL capability, filtering redundant changes
 
 // Auxiliar matrix math functions
-typedef struct rl_float16 {
-    float v[16];
-} rl_float16;
-static rl_float16 rlMatrixToFloatV(Matrix mat);             // Get float array of matrix data
-#define rlMatrixToFloat(mat) (rlMatrixToFloatV(mat).v)      // Get float vector for Matrix
 static Matrix rlMatrixIdentity(void);                       // Get identity matrix
 static Matrix rlMatrixMultiply(Matrix left, Matrix right);  // Multiply two matrices
 static Matrix rlMatrixTranspose(Matrix mat);                // Transposes provided matrix
@@ -1367,7 +1627,20 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
 // NOTE: We store current viewport dimensions
 void rlViewport(int x, int y, int width, int height)
 {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((RLGL.Cache.viewport[0] != (unsigned int)x) || (RLGL.Cache.viewport[1] != (unsigned int)y) ||
+        (RLGL.Cache.viewport[2] != (unsigned int)width) || (RLGL.Cache.viewport[3] != (unsigned int)height))
+    {
+        glViewport(x, y, width, height);
+
+        RLGL.Cache.viewport[0] = x;
+        RLGL.Cache.viewport[1] = y;
+        RLGL.Cache.viewport[2] = width;
+        RLGL.Cache.viewport[3] = height;
+    }
+#else
     glViewport(x, y, width, height);
+#endif
 }
 
 // Set clip planes distances
@@ -1415,6 +1688,25 @@ void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
 void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
 void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+void rlVertex2fv(const float *vertices, int count) { for (int i = 0; i < count; i++) glVertex2fv(vertices + 2*i); }
+void rlVertex3fv(const float *vertices, int count) { for (int i = 0; i < count; i++) glVertex3fv(vertices + 3*i); }
+void rlVertexTexCoord2fv(const float *vertices, const float *texcoords, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        glTexCoord2fv(texcoords + 2*i);
+        glVertex2fv(vertices + 2*i);
+    }
+}
+void rlVertexColor2fv(const float *vertices, const float *texcoords, const unsigned char *colors, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        glColor4ubv(colors + 4*i);
+        if (texcoords != NULL) glTexCoord2fv(texcoords + 2*i);
+        glVertex2fv(vertices + 2*i);
+    }
+}
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Initialize drawing mode (how to organize vertex)
@@ -1591,6 +1883,56 @@ void rlColor3f(float x, float y, float z)
     rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), 255);
 }
 
+// Define multiple vertex (position), 2 float per vertex
+// NOTE: Vertex use current depth, texcoord, normal and color, like rlVertex2f()
+void rlVertex2fv(const float *vertices, int count)
+{
+    rlAppendVertexSpan(vertices, 2, NULL, NULL, count);
+}
+
+// Define multiple vertex (position), 3 float per vertex
+// NOTE: Vertex use current texcoord, normal and color, like rlVertex3f()
+void rlVertex3fv(const float *vertices, int count)
+{
+    rlAppendVertexSpan(vertices, 3, NULL, NULL, count);
+}
+
+// Define multiple vertex (position and texture coordinates), 2 float + 2 float per vertex
+// NOTE: Vertex use current depth, normal and color, last texcoord provided is kept as current texcoord
+void rlVertexTexCoord2fv(const float *vertices, const float *texcoords, int count)
+{
+    rlAppendVertexSpan(vertices, 2, texcoords, NULL, count);
+
+    if (count > 0)
+    {
+        RLGL.State.texcoordx = texcoords[2*(count - 1)];
+        RLGL.State.texcoordy = texcoords[2*(count - 1) + 1];
+    }
+}
+
+// Define multiple vertex (position, texture coordinates and color), 2 float + 2 float + 4 byte per vertex
+// NOTE: Vertex use current depth and normal, current texcoord if texcoords not provided,
+// last texcoord and color provided are kept as current ones
+void rlVertexColor2fv(const float *vertices, const float *texcoords, const unsigned char *colors, int count)
+{
+    rlAppendVertexSpan(vertices, 2, texcoords, colors, count);
+
+    if (count > 0)
+    {
+        if (texcoords != NULL)
+        {
+            RLGL.State.texcoordx = texcoords[2*(count - 1)];
+            RLGL.State.texcoordy = texcoords[2*(count - 1) + 1];
+        }
+
+        const unsigned char *color = colors + 4*(count - 1);
+        RLGL.State.colorr = color[0];
+        RLGL.State.colorg = color[1];
+        RLGL.State.colorb = color[2];
+        RLGL.State.colora = color[3];
+    }
+}
+
 #endif
 
 //--------------------------------------------------------------------------------------
@@ -1615,11 +1957,16 @@ void rlSetTexture(unsigned int id)
     }
     else
     {
+        if (id < rlTextureTrackCount) rlTextureLastFrame[id] = rlFrameCounter;
+
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
+        rlStatsCurrent.textureSwitches++;
 #else
         if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
         {
+            rlStatsCurrent.textureSwitches++;
+
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
             {
                 // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
@@ -1652,17 +1999,23 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    if (RLGL.Cache.activeTextureSlot != (unsigned int)slot)
+    {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        RLGL.Cache.activeTextureSlot = slot;
+    }
 #endif
 }
 
 // Enable texture
 void rlEnableTexture(unsigned int id)
 {
+    if (id < rlTextureTrackCount) rlTextureLastFrame[id] = rlFrameCounter;
+
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture(GL_TEXTURE_2D, id);
 }
 
 // Disable texture
@@ -1671,14 +2024,14 @@ void rlDisableTexture(void)
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Enable texture cubemap
 void rlEnableTextureCubemap(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlBindTexture(GL_TEXTURE_CUBE_MAP, id);
 #endif
 }
 
@@ -1686,14 +2039,14 @@ void rlEnableTextureCubemap(unsigned int id)
 void rlDisableTextureCubemap(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture(GL_TEXTURE_2D, id);
 
 #if !defined(GRAPHICS_API_OPENGL_11)
     // Reset anisotropy filter, in case it was set
@@ -1735,14 +2088,14 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
 void rlCubemapParameters(unsigned int id, int param, int value)
 {
 #if !defined(GRAPHICS_API_OPENGL_11)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlBindTexture(GL_TEXTURE_CUBE_MAP, id);
 
     // Reset anisotropy filter, in case it was set
     glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_ANISOTROPY_EXT, 1.0f);
@@ -1778,7 +2131,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
@@ -1786,7 +2139,12 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    if (RLGL.Cache.shaderId != id)
+    {
+        glUseProgram(id);
+        RLGL.Cache.shaderId = id;
+        rlStatsCurrent.shaderSwitches++;
+    }
 #endif
 }
 
@@ -1794,7 +2152,11 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    if (RLGL.Cache.shaderId != 0)
+    {
+        glUseProgram(0);
+        RLGL.Cache.shaderId = 0;
+    }
 #endif
 }
 
@@ -1802,16 +2164,20 @@ void rlDisableShader(void)
 void rlEnableFramebuffer(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, id);
+    rlBindFramebuffer(GL_FRAMEBUFFER, id);
 #endif
 }
 
 // return the active render texture (fbo)
+// NOTE: Cached binding is used if available, avoiding a pipeline sync
 unsigned int rlGetActiveFramebuffer(void)
 {
     GLint fboId = 0;
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &fboId);
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    if (RLGL.Cache.framebufferId != RL_STATE_UNKNOWN) fboId = (GLint)RLGL.Cache.framebufferId;
+    #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    else glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &fboId);
+    #endif
 #endif
     return fboId;
 }
@@ -1820,7 +2186,7 @@ unsigned int rlGetActiveFramebuffer(void)
 void rlDisableFramebuffer(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    rlBindFramebuffer(GL_FRAMEBUFFER, 0);
 #endif
 }
 
@@ -1836,7 +2202,20 @@ void rlBlitFramebuffer(int srcX, int srcY, int srcWidth, int srcHeight, int dstX
 void rlBindFramebuffer(unsigned int target, unsigned int framebuffer)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(target, framebuffer);
+    if (target == GL_FRAMEBUFFER)
+    {
+        if (RLGL.Cache.framebufferId != framebuffer)
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            RLGL.Cache.framebufferId = framebuffer;
+        }
+    }
+    else
+    {
+        // NOTE: Read and draw bindings could differ now, cache can not track them
+        glBindFramebuffer(target, framebuffer);
+        RLGL.Cache.framebufferId = RL_STATE_UNKNOWN;
+    }
 #endif
 }
 
@@ -1893,28 +2272,42 @@ void rlActiveDrawBuffers(int count)
 //----------------------------------------------------------------------------------
 
 // Enable color blending
-void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
+void rlEnableColorBlend(void) { rlSetCapability(GL_BLEND, true); }
 
 // Disable color blending
-void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
+void rlDisableColorBlend(void) { rlSetCapability(GL_BLEND, false); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { rlSetCapability(GL_DEPTH_TEST, true); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { rlSetCapability(GL_DEPTH_TEST, false); }
 
 // Enable depth write
-void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
+void rlEnableDepthMask(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Cache.depthMask == 1) return;
+    RLGL.Cache.depthMask = 1;
+#endif
+    glDepthMask(GL_TRUE);
+}
 
 // Disable depth write
-void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
+void rlDisableDepthMask(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Cache.depthMask == 0) return;
+    RLGL.Cache.depthMask = 0;
+#endif
+    glDepthMask(GL_FALSE);
+}
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { rlSetCapability(GL_CULL_FACE, true); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { rlSetCapability(GL_CULL_FACE, false); }
 
 // Set color mask active for screen read/draw
 void rlColorMask(bool r, bool g, bool b, bool a) { glColorMask(r, g, b, a); }
@@ -1922,6 +2315,11 @@ void rlColorMask(bool r, bool g, bool b, bool a) { glColorMask(r, g, b, a); }
 // Set face culling mode
 void rlSetCullFace(int mode)
 {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Cache.cullFace == (unsigned int)mode) return;
+    RLGL.Cache.cullFace = mode;
+#endif
+
     switch (mode)
     {
         case RL_CULL_FACE_BACK: glCullFace(GL_BACK); break;
@@ -1931,10 +2329,10 @@ void rlSetCullFace(int mode)
 }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void) { rlSetCapability(GL_SCISSOR_TEST, true); }
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void) { rlSetCapability(GL_SCISSOR_TEST, false); }
 
 // Scissor test
 void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
@@ -2139,6 +2537,21 @@ void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int g
 #endif
 }
 
+// Invalidate internal OpenGL state cache
+// NOTE: rlgl filters redundant state changes (binds, enables, uniform values) comparing with the last values set,
+// any OpenGL state modified out of rlgl requires invalidating the cache before drawing again with rlgl,
+// keep in mind that shader program and textures remain bound after render batch drawing
+void rlInvalidateStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Set all tracked states to RL_STATE_UNKNOWN, next state changes are always issued
+    memset(&RLGL.Cache, 0xff, sizeof(RLGL.Cache));
+    memset(RLGL.Cache.uniforms, 0, sizeof(RLGL.Cache.uniforms));
+
+    RLGL.State.currentBlendMode = -1;   // Force blending mode setup on next change
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL Debug
 //----------------------------------------------------------------------------------
@@ -2252,6 +2665,18 @@ void rlglInit(int width, int height)
     RLGL.State.currentMatrix = &RLGL.State.modelview;
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_OPENGL_33) && defined(RLGL_ENABLE_GPU_TIMERS)
+    // Init GPU timer queries, one set for every frame in flight
+    for (int i = 0; i < RL_GPU_TIMER_SCOPE_COUNT; i++) RLGL.GpuTimer.openQuery[i] = -1;
+
+    if (RLGL.ExtSupported.timerQuery)
+    {
+        for (int i = 0; i < RL_GPU_TIMER_FRAMES_LATENCY; i++) glGenQueries(RL_MAX_GPU_TIMER_QUERIES*2, RLGL.GpuTimer.queries[i]);
+        TRACELOG(RL_LOG_INFO, "RLGL: GPU timer queries initialized successfully");
+    }
+    else TRACELOG(RL_LOG_WARNING, "RLGL: GPU timer queries not supported");
+#endif
+
     // Initialize OpenGL default states
     //----------------------------------------------------------
     // Init state: Depth test
@@ -2292,11 +2717,18 @@ void rlglInit(int width, int height)
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);                   // Set clear color (black)
     glClearDepth(1.0f);                                     // Set clear depth value (default)
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear color and depth buffers (depth buffer required for 3D)
+
+    // Init state cache, states set on initialization are not tracked
+    rlInvalidateStateCache();
 }
 
 // Vertex Buffer Object deinitialization (memory free)
 void rlglClose(void)
 {
+    RL_FREE(rlTextureLastFrame);
+    rlTextureLastFrame = NULL;
+    rlTextureTrackCount = 0;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
@@ -2304,6 +2736,33 @@ void rlglClose(void)
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
+
+    // Unload uniform tables of shader programs not unloaded
+    while (RLGL.UniformTables.count > 0) rlUnloadUniformTable(RLGL.UniformTables.tables[0].shaderId);
+    RL_FREE(RLGL.UniformTables.tables);
+    RLGL.UniformTables.tables = NULL;
+    RLGL.UniformTables.capacity = 0;
+
+    if (RLGL.Indirect.bufferId > 0) glDeleteBuffers(1, &RLGL.Indirect.bufferId);
+    RLGL.Indirect.bufferId = 0;
+    RLGL.Indirect.capacity = 0;
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+    // Unload screen readback buffers, pending requests are discarded
+    for (int i = 0; i < RL_READBACK_BUFFERS; i++)
+    {
+        if (RLGL.Readback.buffers[i].fence != NULL) glDeleteSync((GLsync)RLGL.Readback.buffers[i].fence);
+        if (RLGL.Readback.buffers[i].pboId > 0) glDeleteBuffers(1, &RLGL.Readback.buffers[i].pboId);
+    }
+    memset(RLGL.Readback.buffers, 0, sizeof(RLGL.Readback.buffers));
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) && defined(RLGL_ENABLE_GPU_TIMERS)
+    if (RLGL.ExtSupported.timerQuery)
+    {
+        for (int i = 0; i < RL_GPU_TIMER_FRAMES_LATENCY; i++) glDeleteQueries(RL_MAX_GPU_TIMER_QUERIES*2, RLGL.GpuTimer.queries[i]);
+    }
 #endif
 }
 
@@ -2340,6 +2799,9 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = GLAD_GL_EXT_texture_filter_anisotropic;
     RLGL.ExtSupported.texMirrorClamp = GLAD_GL_EXT_texture_mirror_clamp;
+    RLGL.ExtSupported.timerQuery = GLAD_GL_ARB_timer_query;
+    RLGL.ExtSupported.programBinary = GLAD_GL_ARB_get_program_binary;
+    RLGL.ExtSupported.pixelBufferSync = GLAD_GL_VERSION_3_2;    // NOTE: Fence sync objects require OpenGL 3.2 context
 #else
     // Register supported extensions flags
     // OpenGL 3.3 extensions supported by default (core)
@@ -2352,6 +2814,9 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 32;
     RLGL.ExtSupported.texAnisoFilter = true;
     RLGL.ExtSupported.texMirrorClamp = true;
+    RLGL.ExtSupported.timerQuery = true;
+    RLGL.ExtSupported.programBinary = (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary);
+    RLGL.ExtSupported.pixelBufferSync = true;
 #endif
 
     // Optional OpenGL 3.3 extensions
@@ -2361,6 +2826,7 @@ void rlLoadExtensions(void *loader)
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
+    RLGL.ExtSupported.multiDrawIndirect = GLAD_GL_VERSION_4_3;   // NOTE: Base instance (OpenGL 4.2) also required
     #endif
 
 #endif  // GRAPHICS_API_OPENGL_33
@@ -2378,6 +2844,10 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 24;
     RLGL.ExtSupported.texAnisoFilter = true;
     RLGL.ExtSupported.texMirrorClamp = true;
+    #if !defined(PLATFORM_WEB)
+    RLGL.ExtSupported.programBinary = true;     // NOTE: Not available on WebGL 2.0
+    RLGL.ExtSupported.pixelBufferSync = true;     // NOTE: Buffers mapping not available on WebGL 2.0
+    #endif
     // TODO: Check for additional OpenGL ES 3.0 supported extensions:
     //RLGL.ExtSupported.texCompDXT = true;
     //RLGL.ExtSupported.texCompETC1 = true;
@@ -2571,6 +3041,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.multiDrawIndirect) TRACELOG(RL_LOG_INFO, "GL: Multi-draw indirect supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2727,7 +3198,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
         // Quads - Vertex buffers binding and attributes enable
@@ -2773,7 +3244,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
@@ -2815,12 +3286,12 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlBindVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
-            glBindVertexArray(0);
+            rlBindVertexArray(0);
         }
 
         // Delete VBOs from GPU (VRAM)
@@ -2831,7 +3302,12 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
 
         // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        // NOTE: Deleted VAO binding reverts to zero, state cache must be updated
+        if (RLGL.ExtSupported.vao)
+        {
+            glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+            if (RLGL.Cache.vaoId == batch.vertexBuffer[i].vaoId) RLGL.Cache.vaoId = 0;
+        }
 
         // Free vertex arrays memory from CPU (RAM)
         RL_FREE(batch.vertexBuffer[i].vertices);
@@ -2856,10 +3332,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
+    // NOTE: On static batch recording, batch data is moved to recording buffers and vertex counter reset,
+    // so nothing is uploaded or drawn but batch is reset as usual
+    if (RLGL.Recording.active) rlRecordRenderBatch(batch);
+
     if (RLGL.State.vertexCounter > 0)
     {
         // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        if (RLGL.ExtSupported.vao) rlBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
@@ -2896,8 +3376,8 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // }
         // glUnmapBuffer(GL_ARRAY_BUFFER);
 
-        // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        rlStatsCurrent.batchFlushes++;
+        rlStatsCurrent.bufferBytes += RLGL.State.vertexCounter*(3*sizeof(float) + 2*sizeof(float) + 3*sizeof(float) + 4*sizeof(unsigned char));
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2926,15 +3406,16 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            // NOTE: Redundant shader and uniforms changes are filtered by state cache
+            rlEnableShader(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+            rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], matMVP);
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], RLGL.State.projection);
             }
 
             // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
@@ -2942,20 +3423,20 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], RLGL.State.modelview);
             }
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], RLGL.State.transform);
             }
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform)));
             }
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            if (RLGL.ExtSupported.vao) rlBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
                 // Bind vertex attrib: position (shader-location = 0)
@@ -2982,8 +3463,10 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             }
 
             // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+            float colDiffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            int mapDiffuse = 0;     // Active default sampler2D: texture0
+            rlSetUniform(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], colDiffuse, RL_SHADER_UNIFORM_VEC4, 1);
+            rlSetUniform(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], &mapDiffuse, RL_SHADER_UNIFORM_SAMPLER2D, 1);
 
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
@@ -2991,19 +3474,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlActiveTextureSlot(1 + i);
+                    rlBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlActiveTextureSlot(0);
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                rlBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3019,6 +3502,9 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 #endif
                 }
 
+                rlStatsCurrent.drawCalls++;
+                rlStatsCurrent.vertexCount += batch->draws[i].vertexCount;
+
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
             }
 
@@ -3027,13 +3513,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
-
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+        if (RLGL.ExtSupported.vao) rlBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        // NOTE: Shader program and textures are kept bound, next batch usually requires them again
+        // and state cache filters the redundant binds, use rlInvalidateStateCache() after external OpenGL calls
     }
 
     // Restore viewport to default measures
@@ -3119,128 +3604,464 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
-// Textures data management
-//-----------------------------------------------------------------------------------------
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+// Begin recording render batch data into a static batch
+// NOTE: Vertex are recorded as provided (including rlPushMatrix() transforms),
+// current modelview and projection matrices are applied when static batch is drawn
+void rlBeginStaticBatch(void)
 {
-    unsigned int id = 0;
-
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
-
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
-    }
-#else
-    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
-        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
-        return id;
-    }
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
+    if (RLGL.Recording.active) TRACELOG(RL_LOG_WARNING, "RLGL: Static batch recording already active");
+    else
     {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
-        return id;
-    }
+        rlDrawRenderBatch(RLGL.currentBatch);   // Draw pending data, not part of the static batch
 
-    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
-        return id;
+        RLGL.Recording.active = true;
+        RLGL.Recording.vertexCount = 0;
+        RLGL.Recording.drawCount = 0;
     }
+#endif
+}
 
-    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
+// End recording and load static batch into GPU
+rlStaticBatch rlEndStaticBatch(void)
+{
+    rlStaticBatch batch = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.Recording.active)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
-        return id;
+        TRACELOG(RL_LOG_WARNING, "RLGL: Static batch recording not active");
+        return batch;
     }
 
-    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
+    rlDrawRenderBatch(RLGL.currentBatch);   // Record pending data
+    RLGL.Recording.active = false;
+
+    if (RLGL.Recording.vertexCount > 0)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
-        return id;
-    }
-#endif
-#endif  // GRAPHICS_API_OPENGL_11
+        batch.vertexCount = RLGL.Recording.vertexCount;
+        batch.drawCount = RLGL.Recording.drawCount;
+        batch.draws = (rlDrawCall *)RL_MALLOC(batch.drawCount*sizeof(rlDrawCall));
+        memcpy(batch.draws, RLGL.Recording.draws, batch.drawCount*sizeof(rlDrawCall));
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        // Upload recorded vertex data, same layout than render batch
+        if (RLGL.ExtSupported.vao)
+        {
+            glGenVertexArrays(1, &batch.vaoId);
+            rlBindVertexArray(batch.vaoId);
+        }
 
-    glGenTextures(1, &id);              // Generate texture id
+        glGenBuffers(4, batch.vboId);
 
-    glBindTexture(GL_TEXTURE_2D, id);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, batch.vertexCount*3*sizeof(float), RLGL.Recording.vertices, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 
-    int mipWidth = width;
-    int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset, only used for tracelog
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vboId[1]);
+        glBufferData(GL_ARRAY_BUFFER, batch.vertexCount*2*sizeof(float), RLGL.Recording.texcoords, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
 
-    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
-    unsigned char *dataPtr = NULL;
-    if (data != NULL) dataPtr = (unsigned char *)data;
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vboId[2]);
+        glBufferData(GL_ARRAY_BUFFER, batch.vertexCount*3*sizeof(float), RLGL.Recording.normals, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
 
-    // Load the different mipmap levels
-    for (int i = 0; i < mipmapCount; i++)
-    {
-        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vboId[3]);
+        glBufferData(GL_ARRAY_BUFFER, batch.vertexCount*4*sizeof(unsigned char), RLGL.Recording.colors, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
 
-        unsigned int glInternalFormat, glFormat, glType;
-        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+        if (RLGL.ExtSupported.vao) rlBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-        TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+        rlStatsCurrent.bufferBytes += batch.vertexCount*(3*sizeof(float) + 2*sizeof(float) + 3*sizeof(float) + 4*sizeof(unsigned char));
 
-        if (glInternalFormat != 0)
-        {
-            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, dataPtr);
-#if !defined(GRAPHICS_API_OPENGL_11)
-            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, dataPtr);
-#endif
+        TRACELOG(RL_LOG_INFO, "RLGL: Static batch loaded successfully in VRAM (GPU) [%i vertex, %i draws]", batch.vertexCount, batch.drawCount);
+    }
+    else TRACELOG(RL_LOG_WARNING, "RLGL: Static batch recorded without vertex data");
 
-#if defined(GRAPHICS_API_OPENGL_33)
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
-            {
-#if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+    // Free recording buffers, static batch data is stored in GPU
+    RL_FREE(RLGL.Recording.vertices);
+    RL_FREE(RLGL.Recording.texcoords);
+    RL_FREE(RLGL.Recording.normals);
+    RL_FREE(RLGL.Recording.colors);
+    RL_FREE(RLGL.Recording.draws);
+    memset(&RLGL.Recording, 0, sizeof(RLGL.Recording));
 #endif
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-#endif
-        }
 
-        mipWidth /= 2;
-        mipHeight /= 2;
-        mipOffset += mipSize;       // Increment offset position to next mipmap
-        if (data != NULL) dataPtr += mipSize;         // Increment data pointer to next mipmap
+    return batch;
+}
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
-    }
+// Draw static batch with transform, using current shader and modelview/projection matrices
+// NOTE: Additional batch textures (RLGL.State.activeTextureId) are not considered on static batch drawing
+void rlDrawStaticBatch(rlStaticBatch batch, Matrix transform)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (batch.vertexCount == 0) return;
 
-    // Texture parameters configuration
-    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
-    if (RLGL.ExtSupported.texNPOT)
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
-    }
+    rlDrawRenderBatch(RLGL.currentBatch);   // Keep drawing order with previous draw calls
+
+    rlEnableShader(RLGL.State.currentShaderId);
+
+    // Model transformation matrix is combined with internal transform matrix (rlPushMatrix/rlPopMatrix)
+    Matrix matModel = rlMatrixMultiply(transform, RLGL.State.transform);
+    Matrix matModelView = rlMatrixMultiply(matModel, RLGL.State.modelview);
+
+    if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], RLGL.State.projection);
+    if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], RLGL.State.modelview);
+    if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], matModel);
+    if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], rlMatrixTranspose(rlMatrixInvert(matModel)));
+
+    // Setup some default shader values
+    float colDiffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    int mapDiffuse = 0;     // Active default sampler2D: texture0
+    rlSetUniform(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], colDiffuse, RL_SHADER_UNIFORM_VEC4, 1);
+    rlSetUniform(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], &mapDiffuse, RL_SHADER_UNIFORM_SAMPLER2D, 1);
+
+    if (RLGL.ExtSupported.vao) rlBindVertexArray(batch.vaoId);
     else
     {
-        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vboId[0]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vboId[1]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vboId[2]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vboId[3]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+    }
+
+    rlActiveTextureSlot(0);
+
+    int eyeCount = 1;
+    if (RLGL.State.stereoRender) eyeCount = 2;
+
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        // Calculate model-view-projection matrix (MVP)
+        Matrix matModelViewProjection = rlMatrixMultiply(matModelView, RLGL.State.projection);
+
+        if (eyeCount == 2)
+        {
+            // Setup current eye viewport (half screen width) and eye view offset/projection
+            rlViewport(eye*RLGL.State.framebufferWidth/2, 0, RLGL.State.framebufferWidth/2, RLGL.State.framebufferHeight);
+            matModelViewProjection = rlMatrixMultiply(rlMatrixMultiply(matModelView, RLGL.State.viewOffsetStereo[eye]), RLGL.State.projectionStereo[eye]);
+        }
+
+        rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+
+        for (int i = 0, vertexOffset = 0; i < batch.drawCount; i++)
+        {
+            rlBindTexture(GL_TEXTURE_2D, batch.draws[i].textureId);
+            glDrawArrays(batch.draws[i].mode, vertexOffset, batch.draws[i].vertexCount);
+
+            rlStatsCurrent.drawCalls++;
+            rlStatsCurrent.vertexCount += batch.draws[i].vertexCount;
+
+            vertexOffset += batch.draws[i].vertexCount;
+        }
+    }
+
+    // Restore viewport to default measures
+    if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+    if (RLGL.ExtSupported.vao) rlBindVertexArray(0);
+    else glBindBuffer(GL_ARRAY_BUFFER, 0);
+#endif
+}
+
+// Unload static batch data from CPU and GPU
+void rlUnloadStaticBatch(rlStaticBatch batch)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (batch.vertexCount > 0)
+    {
+        glDeleteBuffers(4, batch.vboId);
+
+        // NOTE: Deleted VAO binding reverts to zero, state cache must be updated
+        if (RLGL.ExtSupported.vao)
+        {
+            glDeleteVertexArrays(1, &batch.vaoId);
+            if (RLGL.Cache.vaoId == batch.vaoId) RLGL.Cache.vaoId = 0;
+        }
+
+        TRACELOG(RL_LOG_INFO, "RLGL: Static batch unloaded successfully from VRAM (GPU)");
+    }
+
+    RL_FREE(batch.draws);
+#endif
+}
+
+// Frame statistics and GPU timers
+//-----------------------------------------------------------------------------------------
+// Get render statistics of last completed frame
+rlFrameStats rlGetFrameStats(void)
+{
+    return rlStatsLast;
+}
+
+// Store current frame statistics and reset counters for next frame
+// NOTE: GPU timings are retrieved from the oldest frame in flight, only if results are already
+// available, so reported values have some frames of latency but pipeline is never stalled
+void rlResetFrameStats(void)
+{
+    float gpuTime[RL_GPU_TIMER_SCOPE_COUNT] = { 0 };
+    for (int i = 0; i < RL_GPU_TIMER_SCOPE_COUNT; i++) gpuTime[i] = rlStatsLast.gpuTime[i];
+
+#if defined(GRAPHICS_API_OPENGL_33) && defined(RLGL_ENABLE_GPU_TIMERS)
+    if (RLGL.ExtSupported.timerQuery)
+    {
+        // Close scopes left open, they can not span multiple frames
+        for (int i = 0; i < RL_GPU_TIMER_SCOPE_COUNT; i++) rlEndGpuTimer(i);
+
+        // Move to next frame in flight, the oldest one
+        RLGL.GpuTimer.currentFrame = (RLGL.GpuTimer.currentFrame + 1)%RL_GPU_TIMER_FRAMES_LATENCY;
+
+        int frame = RLGL.GpuTimer.currentFrame;
+        int available = (RLGL.GpuTimer.counter[frame] > 0);
+
+        // Check all scopes have finished, they could end in a different order than issued
+        for (int i = 0; (i < RLGL.GpuTimer.counter[frame]) && available; i++)
+        {
+            GLint queryAvailable = 0;
+            glGetQueryObjectiv(RLGL.GpuTimer.queries[frame][i*2 + 1], GL_QUERY_RESULT_AVAILABLE, &queryAvailable);
+            available = queryAvailable;
+        }
+
+        if (available)
+        {
+            for (int i = 0; i < RL_GPU_TIMER_SCOPE_COUNT; i++) gpuTime[i] = 0.0f;
+
+            for (int i = 0; i < RLGL.GpuTimer.counter[frame]; i++)
+            {
+                GLuint64 timeBegin = 0;
+                GLuint64 timeEnd = 0;
+                glGetQueryObjectui64v(RLGL.GpuTimer.queries[frame][i*2], GL_QUERY_RESULT, &timeBegin);
+                glGetQueryObjectui64v(RLGL.GpuTimer.queries[frame][i*2 + 1], GL_QUERY_RESULT, &timeEnd);
+
+                // NOTE: Timestamps are provided in nanoseconds
+                gpuTime[RLGL.GpuTimer.scopes[frame][i]] += (float)((double)(timeEnd - timeBegin)/1000000.0);
+            }
+        }
+
+        RLGL.GpuTimer.counter[frame] = 0;
+    }
+#endif
+
+    rlStatsLast = rlStatsCurrent;
+    for (int i = 0; i < RL_GPU_TIMER_SCOPE_COUNT; i++) rlStatsLast.gpuTime[i] = gpuTime[i];
+
+    memset(&rlStatsCurrent, 0, sizeof(rlFrameStats));
+    rlFrameCounter++;
+}
+
+// Get current frame counter
+unsigned int rlGetFrameCounter(void)
+{
+    return rlFrameCounter;
+}
+
+// Track texture usage, frame texture was last set for drawing (rlSetTexture(), rlEnableTexture())
+// NOTE: Usage is stored by texture id, ids lower than the greatest tracked one are also tracked
+void rlTrackTextureUsage(unsigned int id)
+{
+    if (id >= rlTextureTrackCount)
+    {
+        unsigned int count = (id + 1 > 2*rlTextureTrackCount)? id + 1 : 2*rlTextureTrackCount;
+        unsigned int *lastFrame = (unsigned int *)RL_REALLOC(rlTextureLastFrame, count*sizeof(unsigned int));
+
+        if (lastFrame != NULL)
+        {
+            memset(lastFrame + rlTextureTrackCount, 0, (count - rlTextureTrackCount)*sizeof(unsigned int));
+            rlTextureLastFrame = lastFrame;
+            rlTextureTrackCount = count;
+        }
+    }
+
+    if (id < rlTextureTrackCount) rlTextureLastFrame[id] = 0;
+}
+
+// Get frame texture was last set for drawing
+unsigned int rlGetTextureLastFrame(unsigned int id)
+{
+    return (id < rlTextureTrackCount)? rlTextureLastFrame[id] : 0;
+}
+
+// Begin GPU timer scope
+// NOTE: Only one begin/end pair per scope can be open at a time
+void rlBeginGpuTimer(int scope)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && defined(RLGL_ENABLE_GPU_TIMERS)
+    int frame = RLGL.GpuTimer.currentFrame;
+
+    if (RLGL.ExtSupported.timerQuery && (scope >= 0) && (scope < RL_GPU_TIMER_SCOPE_COUNT) &&
+        (RLGL.GpuTimer.openQuery[scope] == -1) && (RLGL.GpuTimer.counter[frame] < RL_MAX_GPU_TIMER_QUERIES))
+    {
+        int index = RLGL.GpuTimer.counter[frame];
+
+        glQueryCounter(RLGL.GpuTimer.queries[frame][index*2], GL_TIMESTAMP);
+
+        RLGL.GpuTimer.scopes[frame][index] = scope;
+        RLGL.GpuTimer.openQuery[scope] = index;
+        RLGL.GpuTimer.counter[frame]++;
+    }
+#endif
+}
+
+// End GPU timer scope
+void rlEndGpuTimer(int scope)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && defined(RLGL_ENABLE_GPU_TIMERS)
+    if (RLGL.ExtSupported.timerQuery && (scope >= 0) && (scope < RL_GPU_TIMER_SCOPE_COUNT) && (RLGL.GpuTimer.openQuery[scope] != -1))
+    {
+        glQueryCounter(RLGL.GpuTimer.queries[RLGL.GpuTimer.currentFrame][RLGL.GpuTimer.openQuery[scope]*2 + 1], GL_TIMESTAMP);
+        RLGL.GpuTimer.openQuery[scope] = -1;
+    }
+#endif
+}
+
+// Textures data management
+//-----------------------------------------------------------------------------------------
+// Check if NPOT textures are fully supported (mipmaps and repeat wrap)
+// NOTE: Limited NPOT support (no mipmaps, clamp wrap) is always available on OpenGL ES 2.0
+bool rlIsTextureNPOTSupported(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.ExtSupported.texNPOT;
+#else
+    return false;
+#endif
+}
+
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+{
+    unsigned int id = 0;
+
+    rlBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
+        return id;
+    }
+#endif
+#endif  // GRAPHICS_API_OPENGL_11
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &id);              // Generate texture id
+
+    rlBindTexture(GL_TEXTURE_2D, id);
+
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset, only used for tracelog
+
+    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
+    unsigned char *dataPtr = NULL;
+    if (data != NULL) dataPtr = (unsigned char *)data;
+
+    // Load the different mipmap levels
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
+
+        unsigned int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+        TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+
+        if (glInternalFormat != 0)
+        {
+            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, dataPtr);
+#if !defined(GRAPHICS_API_OPENGL_11)
+            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, dataPtr);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            {
+#if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+#endif
+        }
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+        mipOffset += mipSize;       // Increment offset position to next mipmap
+        if (data != NULL) dataPtr += mipSize;         // Increment data pointer to next mipmap
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
+
+    // Texture parameters configuration
+    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
+    if (RLGL.ExtSupported.texNPOT)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+    }
+    else
+    {
+        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
     }
 #else
@@ -3266,7 +4087,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     // NOTE: If mipmaps were not in data, they are not generated automatically
 
     // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture(GL_TEXTURE_2D, 0);
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
@@ -3302,7 +4123,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
     if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
     {
         glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
+        rlBindTexture(GL_TEXTURE_2D, id);
         glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -3310,7 +4131,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        rlBindTexture(GL_TEXTURE_2D, 0);
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
@@ -3342,7 +4163,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
     unsigned int dataSize = rlGetPixelDataSize(size, size, format);
 
     glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlBindTexture(GL_TEXTURE_CUBE_MAP, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3397,7 +4218,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
 #endif
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
@@ -3410,7 +4231,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture(GL_TEXTURE_2D, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3422,6 +4243,177 @@ void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int h
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
 
+// Reload texture data on GPU, texture storage is replaced keeping the same texture id
+// NOTE: Texture parameters are kept, if previous texture had more mipmap levels,
+// remaining levels are not used once provided mipmaps chain is complete
+void rlReloadTexture(unsigned int id, const void *data, int width, int height, int format, int mipmapCount)
+{
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat == 0)
+    {
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to reload for current texture format (%i)", id, format);
+        return;
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    rlBindTexture(GL_TEXTURE_2D, id);
+
+    int mipWidth = width;
+    int mipHeight = height;
+    unsigned char *dataPtr = (unsigned char *)data;
+
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
+
+        if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, dataPtr);
+#if !defined(GRAPHICS_API_OPENGL_11)
+        else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, dataPtr);
+#endif
+        rlStatsCurrent.bufferBytes += mipSize;
+
+        mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+        mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+        if (dataPtr != NULL) dataPtr += mipSize;
+    }
+
+    rlBindTexture(GL_TEXTURE_2D, 0);
+
+    TRACELOGD("TEXTURE: [ID %i] Texture reloaded successfully (%ix%i | %i mipmaps)", id, width, height, mipmapCount);
+}
+
+// Load texture stream for texture updates through pixel buffers
+// NOTE: If pixel buffers are not supported, pixel data is kept in CPU memory and uploaded with rlUpdateTexture()
+rlTextureStream rlLoadTextureStream(unsigned int id, int width, int height, int format)
+{
+    rlTextureStream stream = { 0 };
+
+    if ((id == 0) || (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Texture stream requires an uncompressed texture", id);
+        return stream;
+    }
+
+    stream.textureId = id;
+    stream.width = width;
+    stream.height = height;
+    stream.format = format;
+    stream.size = rlGetPixelDataSize(width, height, format);
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+    if (RLGL.ExtSupported.pixelBufferSync)
+    {
+        glGenBuffers(RL_TEXTURE_STREAM_BUFFERS, stream.pboId);
+
+        for (int i = 0; i < RL_TEXTURE_STREAM_BUFFERS; i++)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream.pboId[i]);
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, stream.size, NULL, GL_STREAM_DRAW);
+        }
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture stream loaded successfully (%i pixel buffers)", id, RL_TEXTURE_STREAM_BUFFERS);
+    }
+#endif
+
+    if (stream.pboId[0] == 0)
+    {
+        stream.data = (unsigned char *)RL_CALLOC(stream.size, 1);
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture stream loaded successfully (CPU memory)", id);
+    }
+
+    return stream;
+}
+
+// Unload texture stream pixel buffers (texture not unloaded)
+void rlUnloadTextureStream(rlTextureStream *stream)
+{
+    if (stream->mapped != NULL) rlUnmapTextureStream(stream);
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+    for (int i = 0; i < RL_TEXTURE_STREAM_BUFFERS; i++)
+    {
+        if (stream->fence[i] != NULL) glDeleteSync((GLsync)stream->fence[i]);
+    }
+
+    if (stream->pboId[0] > 0) glDeleteBuffers(RL_TEXTURE_STREAM_BUFFERS, stream->pboId);
+#endif
+
+    RL_FREE(stream->data);
+
+    if (stream->textureId > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture stream unloaded successfully", stream->textureId);
+
+    memset(stream, 0, sizeof(rlTextureStream));
+}
+
+// Map next texture stream buffer, returns memory to write pixel data
+// NOTE: Producer can write pixel data directly into mapped memory (no intermediate copy),
+// buffer is only waited for if its previous upload (RL_TEXTURE_STREAM_BUFFERS updates ago) is still in flight
+void *rlMapTextureStream(rlTextureStream *stream)
+{
+    if (stream->mapped != NULL) return stream->mapped;
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+    if (stream->pboId[0] > 0)
+    {
+        int index = (stream->current + 1)%RL_TEXTURE_STREAM_BUFFERS;
+
+        if (stream->fence[index] != NULL)
+        {
+            glClientWaitSync((GLsync)stream->fence[index], GL_SYNC_FLUSH_COMMANDS_BIT, RL_READBACK_TIMEOUT);
+            glDeleteSync((GLsync)stream->fence[index]);
+            stream->fence[index] = NULL;
+        }
+
+        // NOTE: Buffer upload completed (fence signaled), unsynchronized mapping avoids any implicit driver sync
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream->pboId[index]);
+        stream->mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, stream->size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        if (stream->mapped != NULL) stream->current = index;
+        else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to map texture stream buffer", stream->textureId);
+
+        return stream->mapped;
+    }
+#endif
+
+    stream->mapped = stream->data;
+
+    return stream->mapped;
+}
+
+// Unmap texture stream buffer and upload pixel data to texture (asynchronous)
+void rlUnmapTextureStream(rlTextureStream *stream)
+{
+    if (stream->mapped == NULL) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+    if (stream->pboId[0] > 0)
+    {
+        int index = stream->current;
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream->pboId[index]);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+        // NOTE: With a pixel unpack buffer bound, pixels pointer is an offset into the buffer,
+        // the copy into texture is done by GPU without stalling the CPU
+        rlUpdateTexture(stream->textureId, 0, 0, stream->width, stream->height, stream->format, NULL);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        stream->fence[index] = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        stream->mapped = NULL;
+
+        return;
+    }
+#endif
+
+    rlUpdateTexture(stream->textureId, 0, 0, stream->width, stream->height, stream->format, stream->data);
+    stream->mapped = NULL;
+}
+
 // Get OpenGL internal formats and data type from raylib PixelFormat
 void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
 {
@@ -3499,6 +4491,15 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 void rlUnloadTexture(unsigned int id)
 {
     glDeleteTextures(1, &id);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Deleted textures are unbound from all texture slots
+    for (int i = 0; i < RL_STATE_CACHE_TEXTURE_SLOTS; i++)
+    {
+        if (RLGL.Cache.textureId[i] == id) RLGL.Cache.textureId[i] = 0;
+        if (RLGL.Cache.cubemapId[i] == id) RLGL.Cache.cubemapId[i] = 0;
+    }
+#endif
 }
 
 // Generate mipmap data for selected texture
@@ -3506,7 +4507,7 @@ void rlUnloadTexture(unsigned int id)
 void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture(GL_TEXTURE_2D, id);
 
     // Check if texture is power-of-two (POT)
     bool texIsPOT = false;
@@ -3527,7 +4528,7 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture(GL_TEXTURE_2D, 0);
 #else
     TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
 #endif
@@ -3539,7 +4540,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     void *pixels = NULL;
 
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlBindTexture(GL_TEXTURE_2D, id);
 
     // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
     // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
@@ -3565,7 +4566,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindTexture(GL_TEXTURE_2D, 0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -3578,8 +4579,8 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     // NOTE: This behaviour could be conditioned by graphic driver...
     unsigned int fboId = rlLoadFramebuffer();
 
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    rlBindTexture(GL_TEXTURE_2D, 0);
 
     // Attach our texture to FBO
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
@@ -3588,7 +4589,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     pixels = (unsigned char *)RL_MALLOC(rlGetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
     glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    rlBindFramebuffer(GL_FRAMEBUFFER, 0);
 
     // Clean up temporal fbo
     rlUnloadFramebuffer(fboId);
@@ -3600,28 +4601,108 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
 // Read screen pixel data (color buffer)
 unsigned char *rlReadScreenPixels(int width, int height)
 {
-    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
 
     // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
     // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, imgData);
 
     // Flip image vertically!
-    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+    rlFlipScreenPixels(imgData, width, height);
 
-    for (int y = height - 1; y >= 0; y--)
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Request screen pixel data readback (color buffer), to be retrieved with rlGetScreenPixelsAsync()
+// NOTE: Pixel data is copied into a pixel buffer object avoiding the pipeline stall of glReadPixels(),
+// data is usually available one or two frames later, up to RL_READBACK_BUFFERS requests can be pending
+// WARNING: Returns 0 if not supported (OpenGL 1.1, OpenGL ES 2.0, WebGL) or all readback buffers pending
+unsigned int rlReadScreenPixelsAsync(int width, int height)
+{
+    unsigned int requestId = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+    if (RLGL.ExtSupported.pixelBufferSync)
     {
-        for (int x = 0; x < (width*4); x++)
+        rlReadbackBuffer *buffer = &RLGL.Readback.buffers[(RLGL.Readback.counter + 1)%RL_READBACK_BUFFERS];
+
+        if (buffer->requestId == 0)
         {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+            int size = width*height*4;
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
+            if (buffer->pboId == 0) glGenBuffers(1, &buffer->pboId);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer->pboId);
+
+            if (buffer->size < size)
+            {
+                glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+                buffer->size = size;
+            }
+
+            // NOTE: With a pixel pack buffer bound, pixels pointer is an offset into the buffer
+            glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+            buffer->fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            buffer->width = width;
+            buffer->height = height;
+
+            RLGL.Readback.counter++;
+            if (RLGL.Readback.counter == 0) RLGL.Readback.counter++;    // Skip 0 on overflow, not a valid request id
+            buffer->requestId = RLGL.Readback.counter;
+            requestId = buffer->requestId;
         }
+        else TRACELOG(RL_LOG_WARNING, "GL: Screen readback buffers pending, pixels must be retrieved with rlGetScreenPixelsAsync()");
     }
+#endif
+
+    return requestId;
+}
+
+// Get requested screen pixel data, NULL if not available yet
+// NOTE: If wait is requested, blocks until pixel data is available, request is always released
+unsigned char *rlGetScreenPixelsAsync(unsigned int requestId, bool wait)
+{
+    unsigned char *imgData = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+    rlReadbackBuffer *buffer = &RLGL.Readback.buffers[requestId%RL_READBACK_BUFFERS];
 
-    RL_FREE(screenData);
+    if ((requestId > 0) && (buffer->requestId == requestId))
+    {
+        // NOTE: Commands must be flushed, otherwise fence could never be signaled
+        GLenum result = glClientWaitSync((GLsync)buffer->fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait? RL_READBACK_TIMEOUT : 0);
+
+        if ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED))
+        {
+            int size = buffer->width*buffer->height*4;
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer->pboId);
+            void *data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+
+            if (data != NULL)
+            {
+                imgData = (unsigned char *)RL_MALLOC(size);
+                memcpy(imgData, data, size);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+                // Flip image vertically!
+                rlFlipScreenPixels(imgData, buffer->width, buffer->height);
+            }
+            else TRACELOG(RL_LOG_WARNING, "GL: Failed to map screen readback buffer");
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+        else if (wait || (result == GL_WAIT_FAILED)) TRACELOG(RL_LOG_WARNING, "GL: Failed to retrieve screen readback pixels");
+
+        if ((imgData != NULL) || wait || (result == GL_WAIT_FAILED))
+        {
+            glDeleteSync((GLsync)buffer->fence);
+            buffer->fence = NULL;
+            buffer->requestId = 0;
+        }
+    }
+#endif
 
     return imgData;     // NOTE: image data should be freed
 }
@@ -3636,7 +4717,7 @@ unsigned int rlLoadFramebuffer(void)
 
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glGenFramebuffers(1, &fboId);       // Create the framebuffer object
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
+    rlBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
 #endif
 
     return fboId;
@@ -3647,7 +4728,7 @@ unsigned int rlLoadFramebuffer(void)
 void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    rlBindFramebuffer(GL_FRAMEBUFFER, fboId);
 
     switch (attachType)
     {
@@ -3680,7 +4761,7 @@ void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType,
         default: break;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    rlBindFramebuffer(GL_FRAMEBUFFER, 0);
 #endif
 }
 
@@ -3690,7 +4771,7 @@ bool rlFramebufferComplete(unsigned int id)
     bool result = false;
 
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, id);
+    rlBindFramebuffer(GL_FRAMEBUFFER, id);
 
     GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
 
@@ -3708,7 +4789,7 @@ bool rlFramebufferComplete(unsigned int id)
         }
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    rlBindFramebuffer(GL_FRAMEBUFFER, 0);
 
     result = (status == GL_FRAMEBUFFER_COMPLETE);
 #endif
@@ -3723,7 +4804,7 @@ void rlUnloadFramebuffer(unsigned int id)
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     // Query depth attachment to automatically delete texture/renderbuffer
     int depthType = 0, depthId = 0;
-    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
+    rlBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
     glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
 
     // TODO: Review warning retrieving object name in WebGL
@@ -3733,12 +4814,12 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_TEXTURE) rlUnloadTexture(depthIdU);    // Texture is also removed from state cache
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer.
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    rlBindFramebuffer(GL_FRAMEBUFFER, 0);
     glDeleteFramebuffers(1, &id);
 
     TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
@@ -3756,6 +4837,7 @@ unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
     glGenBuffers(1, &id);
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    if (buffer != NULL) rlStatsCurrent.bufferBytes += size;
 #endif
 
     return id;
@@ -3770,6 +4852,7 @@ unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynami
     glGenBuffers(1, &id);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    if (buffer != NULL) rlStatsCurrent.bufferBytes += size;
 #endif
 
     return id;
@@ -3814,6 +4897,7 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    rlStatsCurrent.bufferBytes += dataSize;
 #endif
 }
 
@@ -3824,6 +4908,7 @@ void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSiz
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    rlStatsCurrent.bufferBytes += dataSize;
 #endif
 }
 
@@ -3834,7 +4919,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(vaoId);
+        rlBindVertexArray(vaoId);
         result = true;
     }
 #endif
@@ -3845,7 +4930,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 void rlDisableVertexArray(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlBindVertexArray(0);
 #endif
 }
 
@@ -3869,6 +4954,9 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+
+    rlStatsCurrent.drawCalls++;
+    rlStatsCurrent.vertexCount += count;
 }
 
 // Draw vertex array elements
@@ -3879,6 +4967,9 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
     if (offset > 0) bufferPtr += offset;
 
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+
+    rlStatsCurrent.drawCalls++;
+    rlStatsCurrent.vertexCount += count;
 }
 
 // Draw vertex array instanced
@@ -3886,6 +4977,9 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+
+    rlStatsCurrent.drawCalls++;
+    rlStatsCurrent.vertexCount += count*instances;
 #endif
 }
 
@@ -3898,6 +4992,60 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
     if (offset > 0) bufferPtr += offset;
 
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+
+    rlStatsCurrent.drawCalls++;
+    rlStatsCurrent.vertexCount += count*instances;
+#endif
+}
+
+// Draw vertex array elements commands, elements buffer of currently active vao (unsigned int indices)
+// NOTE: Commands are submitted with a single glMultiDrawElementsIndirect() call if supported,
+// otherwise they are drawn one by one (instanceCount and baseInstance are ignored)
+void rlDrawVertexArrayElementsIndirect(const rlDrawElementsCommand *commands, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((commands == NULL) || (count <= 0)) return;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    // NOTE: A single command is drawn directly, no need to upload it
+    if (RLGL.ExtSupported.multiDrawIndirect && (count > 1))
+    {
+        if (RLGL.Indirect.bufferId == 0) glGenBuffers(1, &RLGL.Indirect.bufferId);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, RLGL.Indirect.bufferId);
+
+        // Commands buffer is orphaned on every submission, driver provides a new storage if previous one is still in use
+        if (count > RLGL.Indirect.capacity) RLGL.Indirect.capacity = count;
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, RLGL.Indirect.capacity*sizeof(rlDrawElementsCommand), NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, count*sizeof(rlDrawElementsCommand), commands);
+
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, 0, count, 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+        rlStatsCurrent.drawCalls++;
+        rlStatsCurrent.bufferBytes += count*sizeof(rlDrawElementsCommand);
+        for (int i = 0; i < count; i++) rlStatsCurrent.vertexCount += commands[i].count*commands[i].instanceCount;
+        return;
+    }
+#endif
+
+    for (int i = 0; i < count; i++)
+    {
+        // NOTE: Elements buffer offset provided as pointer, it is not a CPU memory address
+        glDrawElements(GL_TRIANGLES, commands[i].count, GL_UNSIGNED_INT, (const void *)((size_t)commands[i].firstIndex*sizeof(unsigned int)));
+
+        rlStatsCurrent.drawCalls++;
+        rlStatsCurrent.vertexCount += commands[i].count;
+    }
+#endif
+}
+
+// Check if multi-draw indirect is supported
+bool rlIsMultiDrawIndirectSupported(void)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    return RLGL.ExtSupported.multiDrawIndirect;     // NOTE: Shader storage buffers also available with OpenGL 4.3
+#else
+    return false;
 #endif
 }
 
@@ -3965,7 +5113,7 @@ void rlUnloadVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(0);
+        rlBindVertexArray(0);
         glDeleteVertexArrays(1, &vaoId);
         TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
     }
@@ -4126,55 +5274,153 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     GLint success = 0;
     program = glCreateProgram();
 
-    glAttachShader(program, vShaderId);
-    glAttachShader(program, fShaderId);
+    glAttachShader(program, vShaderId);
+    glAttachShader(program, fShaderId);
+
+    // NOTE: Default attribute shader locations must be Bound before linking
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_DRAWID, RL_DEFAULT_SHADER_ATTRIB_NAME_DRAWID);
+
+    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+    // Hint driver program binary is going to be retrieved, required by some drivers
+    if (RLGL.ExtSupported.programBinary) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            RL_FREE(log);
+        }
+
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else
+    {
+        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
+        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
+        //GLint binarySize = 0;
+        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
+
+        rlLoadUniformTable(program);
+    }
+#endif
+    return program;
+}
+
+// Get shader program binary data, returned data must be freed by caller (RL_FREE)
+// NOTE: Binary data includes a small header to validate it on loading: driver hash and binary format,
+// program binaries are only valid for the same GPU and driver version they were generated
+unsigned char *rlGetShaderProgramBinary(unsigned int id, int *dataSize)
+{
+    unsigned char *data = NULL;
+    if (dataSize != NULL) *dataSize = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+    if (RLGL.ExtSupported.programBinary && (id > 0))
+    {
+        GLint binarySize = 0;
+        glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        if (binarySize > 0)
+        {
+            unsigned int header[4] = { RL_SHADER_BINARY_MAGIC, rlGetDriverHash(), 0, 0 };
+
+            data = (unsigned char *)RL_MALLOC(sizeof(header) + binarySize);
+
+            GLsizei length = 0;
+            GLenum format = 0;
+            glGetProgramBinary(id, binarySize, &length, &format, data + sizeof(header));
+
+            if (length > 0)
+            {
+                header[2] = (unsigned int)format;
+                header[3] = (unsigned int)length;
+                memcpy(data, header, sizeof(header));
+
+                if (dataSize != NULL) *dataSize = (int)sizeof(header) + length;
+            }
+            else
+            {
+                RL_FREE(data);
+                data = NULL;
+            }
+        }
+
+        if (data == NULL) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to get program binary", id);
+    }
+#endif
+
+    return data;
+}
+
+// Load shader program from binary data (generated with rlGetShaderProgramBinary())
+// NOTE: Returns 0 if binary is not valid for current driver, program must be compiled from code
+unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int dataSize)
+{
+    unsigned int program = 0;
 
-    // NOTE: Default attribute shader locations must be Bound before linking
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+    unsigned int header[4] = { 0 };
 
-    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+    if (!RLGL.ExtSupported.programBinary || (data == NULL) || (dataSize <= (int)sizeof(header))) return 0;
 
-    glLinkProgram(program);
+    memcpy(header, data, sizeof(header));
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+    if ((header[0] != RL_SHADER_BINARY_MAGIC) || (header[1] != rlGetDriverHash()) || ((int)header[3] != (dataSize - (int)sizeof(header))))
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: Program binary not valid for current driver, it must be compiled");
+        return 0;
+    }
 
+    program = glCreateProgram();
+    glProgramBinary(program, (GLenum)header[2], data + sizeof(header), (GLsizei)header[3]);
+
+    // NOTE: Driver could reject the binary (i.e. driver updated), link status reports it
+    GLint success = 0;
     glGetProgramiv(program, GL_LINK_STATUS, &success);
 
     if (success == GL_FALSE)
     {
-        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
-
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
-
-        if (maxLength > 0)
-        {
-            int length = 0;
-            char *log = (char *)RL_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            RL_FREE(log);
-        }
+        TRACELOG(RL_LOG_INFO, "SHADER: Program binary rejected by driver, it must be compiled");
 
         glDeleteProgram(program);
-
         program = 0;
     }
     else
     {
-        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
-        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
-        //GLint binarySize = 0;
-        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully from binary", program);
 
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
+        rlLoadUniformTable(program);
     }
 #endif
+
     return program;
 }
 
@@ -4182,6 +5428,11 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
 void rlUnloadShaderProgram(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Program is only deleted by OpenGL once it is not in use
+    if (RLGL.Cache.shaderId == id) rlDisableShader();
+    rlClearUniformCache(id, -1, 0);
+    rlUnloadUniformTable(id);
+
     glDeleteProgram(id);
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
@@ -4193,7 +5444,19 @@ int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
 {
     int location = -1;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    location = glGetUniformLocation(shaderId, uniformName);
+    // Look for uniform location in shader uniforms table, loaded on shader program linking
+    // NOTE: Names not found in table (i.e. array elements, uniforms not active) are requested to
+    // OpenGL and stored in table, so the string query is only done once per name
+    rlUniformTable *table = rlGetUniformTable(shaderId);
+    int *entry = (table != NULL)? rlFindUniformTableEntry(table, uniformName, false) : NULL;
+
+    if (entry != NULL) location = *entry;
+    else
+    {
+        location = glGetUniformLocation(shaderId, uniformName);
+
+        if (table != NULL) *rlFindUniformTableEntry(table, uniformName, true) = location;
+    }
 
     //if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
     //else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader uniform (%s) set at location: %i", shaderId, uniformName, location);
@@ -4218,6 +5481,28 @@ int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
 void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Check uniform value in state cache, only single values are tracked
+    if (count == 1)
+    {
+        int size = 0;
+        switch (uniformType)
+        {
+            case RL_SHADER_UNIFORM_FLOAT: size = sizeof(float); break;
+            case RL_SHADER_UNIFORM_VEC2: size = 2*sizeof(float); break;
+            case RL_SHADER_UNIFORM_VEC3: size = 3*sizeof(float); break;
+            case RL_SHADER_UNIFORM_VEC4: size = 4*sizeof(float); break;
+            case RL_SHADER_UNIFORM_INT: size = sizeof(int); break;
+            case RL_SHADER_UNIFORM_IVEC2: size = 2*sizeof(int); break;
+            case RL_SHADER_UNIFORM_IVEC3: size = 3*sizeof(int); break;
+            case RL_SHADER_UNIFORM_IVEC4: size = 4*sizeof(int); break;
+            case RL_SHADER_UNIFORM_SAMPLER2D: size = sizeof(int); break;
+            default: break;
+        }
+
+        if ((size > 0) && rlCheckUniformCache(locIndex, value, size)) return;
+    }
+    else rlClearUniformCache(RLGL.Cache.shaderId, locIndex, count);
+
     switch (uniformType)
     {
         case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
@@ -4259,7 +5544,8 @@ void rlSetUniformMatrix(int locIndex, Matrix mat)
         mat.m8, mat.m9, mat.m10, mat.m11,
         mat.m12, mat.m13, mat.m14, mat.m15
     };
-    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+
+    if (!rlCheckUniformCache(locIndex, matfloat, sizeof(matfloat))) glUniformMatrix4fv(locIndex, 1, false, matfloat);
 #endif
 }
 
@@ -4272,7 +5558,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == textureId)
         {
-            glUniform1i(locIndex, 1 + i);
+            int slot = 1 + i;
+            if (!rlCheckUniformCache(locIndex, &slot, sizeof(int))) glUniform1i(locIndex, slot);
             return;
         }
     }
@@ -4283,7 +5570,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == 0)
         {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
+            int slot = 1 + i;
+            if (!rlCheckUniformCache(locIndex, &slot, sizeof(int))) glUniform1i(locIndex, slot); // Activate new texture unit
             RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
             break;
         }
@@ -4391,6 +5679,7 @@ void rlUpdateShaderBuffer(unsigned int id, const void *data, unsigned int dataSi
 #if defined(GRAPHICS_API_OPENGL_43)
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
     glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
+    rlStatsCurrent.bufferBytes += dataSize;
 #endif
 }
 
@@ -4590,7 +5879,7 @@ void rlLoadDrawQuad(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+    rlBindVertexArray(quadVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &quadVBO);
@@ -4604,9 +5893,9 @@ void rlLoadDrawQuad(void)
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
 
     // Draw quad
-    glBindVertexArray(quadVAO);
+    rlBindVertexArray(quadVAO);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    rlBindVertexArray(0);
 
     // Delete buffers (VBO and VAO)
     glDeleteBuffers(1, &quadVBO);
@@ -4663,7 +5952,7 @@ void rlLoadDrawCube(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+    rlBindVertexArray(cubeVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &cubeVBO);
@@ -4671,7 +5960,7 @@ void rlLoadDrawCube(void)
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
+    rlBindVertexArray(cubeVAO);
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
@@ -4679,12 +5968,12 @@ void rlLoadDrawCube(void)
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    rlBindVertexArray(0);
 
     // Draw cube
-    glBindVertexArray(cubeVAO);
+    rlBindVertexArray(cubeVAO);
     glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    rlBindVertexArray(0);
 
     // Delete VBO and VAO
     glDeleteBuffers(1, &cubeVBO);
@@ -4841,7 +6130,7 @@ static void rlLoadShaderDefault(void)
 // NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
 static void rlUnloadShaderDefault(void)
 {
-    glUseProgram(0);
+    rlDisableShader();
 
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
@@ -4855,6 +6144,410 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Bind vertex array, filtering redundant binds with state cache
+static void rlBindVertexArray(unsigned int vaoId)
+{
+    if (RLGL.Cache.vaoId != vaoId)
+    {
+        glBindVertexArray(vaoId);
+        RLGL.Cache.vaoId = vaoId;
+    }
+}
+
+// Check uniform value is already set for current shader program
+// NOTE: Value is registered in state cache if not set, caller must upload it
+static bool rlCheckUniformCache(int location, const void *value, int size)
+{
+    bool cached = false;
+
+    if (location < 0) cached = true;    // Uniform not available in shader, OpenGL ignores it
+    else if ((RLGL.Cache.shaderId != RL_STATE_UNKNOWN) && (RLGL.Cache.shaderId != 0) && (size <= 64))
+    {
+        rlUniformCache *entry = &RLGL.Cache.uniforms[(RLGL.Cache.shaderId*31 + location)&(RL_STATE_CACHE_UNIFORMS - 1)];
+
+        if ((entry->shaderId == RLGL.Cache.shaderId) && (entry->location == location) &&
+            (entry->size == size) && (memcmp(entry->value, value, size) == 0)) cached = true;
+        else
+        {
+            // Replace entry, collisions just evict previous value
+            entry->shaderId = RLGL.Cache.shaderId;
+            entry->location = location;
+            entry->size = size;
+            memcpy(entry->value, value, size);
+        }
+    }
+
+    return cached;
+}
+
+// Append multiple vertex to current batch, position is transformed and current attributes are broadcasted
+// NOTE: Span is split on primitive boundaries (RL_LINES: 2, RL_TRIANGLES: 3, RL_QUADS: 4 vertex)
+// when batch is full, same as rlVertex3f() it is required to not break primitives between batches
+static void rlAppendVertexSpan(const float *vertices, int components, const float *texcoords, const unsigned char *colors, int count)
+{
+    int mode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
+    int primitiveSize = (mode == RL_LINES)? 2 : ((mode == RL_TRIANGLES)? 3 : 4);
+
+    // Complete primitive partially defined by single vertex functions, if required
+    while ((count > 0) && ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%primitiveSize) != 0))
+    {
+        if (texcoords != NULL) { rlTexCoord2f(texcoords[0], texcoords[1]); texcoords += 2; }
+        if (colors != NULL) { rlColor4ub(colors[0], colors[1], colors[2], colors[3]); colors += 4; }
+        rlVertex3f(vertices[0], vertices[1], (components == 3)? vertices[2] : RLGL.currentBatch->currentDepth);
+
+        vertices += components;
+        count--;
+    }
+
+    while (count > 0)
+    {
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+        // Get number of vertex fitting on current batch buffer, only full primitives if not all of them fit
+        // NOTE: We keep 1 spare vertex for security, same as rlVertex3f()
+        int available = buffer->elementCount*4 - 1 - RLGL.State.vertexCounter;
+        int span = (count <= available)? count : (available - available%primitiveSize);
+
+        if (span <= 0)
+        {
+            // Launch a draw call but keep current state for next vertices coming
+            rlCheckRenderBatchLimit(primitiveSize + 1);
+            continue;
+        }
+
+        int index = RLGL.State.vertexCounter;
+
+        // Add vertices, transformed if required
+        rlTransformVertexSpan(buffer->vertices + 3*index, vertices, components, RLGL.currentBatch->currentDepth, span);
+
+        // Add texcoords, provided or current one
+        if (texcoords != NULL) memcpy(buffer->texcoords + 2*index, texcoords, 2*span*sizeof(float));
+        else
+        {
+            float *texcoord = buffer->texcoords + 2*index;
+            for (int i = 0; i < span; i++, texcoord += 2) { texcoord[0] = RLGL.State.texcoordx; texcoord[1] = RLGL.State.texcoordy; }
+        }
+
+        // Add current normal
+        float *normal = buffer->normals + 3*index;
+        for (int i = 0; i < span; i++, normal += 3) { normal[0] = RLGL.State.normalx; normal[1] = RLGL.State.normaly; normal[2] = RLGL.State.normalz; }
+
+        // Add colors, provided or current one copied as a single 32bit value
+        if (colors != NULL) memcpy(buffer->colors + 4*index, colors, 4*span);
+        else
+        {
+            unsigned char color[4] = { RLGL.State.colorr, RLGL.State.colorg, RLGL.State.colorb, RLGL.State.colora };
+            for (int i = 0; i < span; i++) memcpy(buffer->colors + 4*(index + i), color, 4);
+        }
+
+        RLGL.State.vertexCounter += span;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += span;
+
+        vertices += components*span;
+        if (texcoords != NULL) texcoords += 2*span;
+        if (colors != NULL) colors += 4*span;
+        count -= span;
+    }
+}
+
+// Record render batch data into static batch, render batch vertex counter is reset (nothing to draw)
+// NOTE: RL_QUADS are converted to RL_TRIANGLES, consecutive draws with same mode and texture are merged
+static void rlRecordRenderBatch(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+    // Required space considering quads conversion (6 vertex per 4)
+    int required = RLGL.Recording.vertexCount + RLGL.State.vertexCounter/4*6 + 6;
+
+    if (required > RLGL.Recording.vertexCapacity)
+    {
+        int capacity = (RLGL.Recording.vertexCapacity > 0)? RLGL.Recording.vertexCapacity : 4096;
+        while (capacity < required) capacity *= 2;
+
+        RLGL.Recording.vertices = (float *)RL_REALLOC(RLGL.Recording.vertices, capacity*3*sizeof(float));
+        RLGL.Recording.texcoords = (float *)RL_REALLOC(RLGL.Recording.texcoords, capacity*2*sizeof(float));
+        RLGL.Recording.normals = (float *)RL_REALLOC(RLGL.Recording.normals, capacity*3*sizeof(float));
+        RLGL.Recording.colors = (unsigned char *)RL_REALLOC(RLGL.Recording.colors, capacity*4*sizeof(unsigned char));
+        RLGL.Recording.vertexCapacity = capacity;
+    }
+
+    if ((RLGL.Recording.drawCount + batch->drawCounter) > RLGL.Recording.drawCapacity)
+    {
+        RLGL.Recording.drawCapacity = RLGL.Recording.drawCount + batch->drawCounter + RL_DEFAULT_BATCH_DRAWCALLS;
+        RLGL.Recording.draws = (rlDrawCall *)RL_REALLOC(RLGL.Recording.draws, RLGL.Recording.drawCapacity*sizeof(rlDrawCall));
+    }
+
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        int mode = (batch->draws[i].mode == RL_QUADS)? RL_TRIANGLES : batch->draws[i].mode;
+        int vertexCount = (batch->draws[i].mode == RL_QUADS)? batch->draws[i].vertexCount/4*6 : batch->draws[i].vertexCount;
+
+        if (vertexCount > 0)
+        {
+            // Copy draw vertex, quads are converted to two triangles (0, 1, 2) and (0, 2, 3)
+            for (int v = 0; v < vertexCount; v++)
+            {
+                int src = vertexOffset + v;
+                if (batch->draws[i].mode == RL_QUADS) src = vertexOffset + (v/6)*4 + ((v%6 < 3)? v%6 : ((v%6 == 3)? 0 : v%6 - 2));
+
+                int dst = RLGL.Recording.vertexCount + v;
+                memcpy(RLGL.Recording.vertices + 3*dst, buffer->vertices + 3*src, 3*sizeof(float));
+                memcpy(RLGL.Recording.texcoords + 2*dst, buffer->texcoords + 2*src, 2*sizeof(float));
+                memcpy(RLGL.Recording.normals + 3*dst, buffer->normals + 3*src, 3*sizeof(float));
+                memcpy(RLGL.Recording.colors + 4*dst, buffer->colors + 4*src, 4*sizeof(unsigned char));
+            }
+
+            RLGL.Recording.vertexCount += vertexCount;
+
+            rlDrawCall *last = (RLGL.Recording.drawCount > 0)? &RLGL.Recording.draws[RLGL.Recording.drawCount - 1] : NULL;
+
+            if ((last != NULL) && (last->mode == mode) && (last->textureId == batch->draws[i].textureId)) last->vertexCount += vertexCount;
+            else
+            {
+                RLGL.Recording.draws[RLGL.Recording.drawCount].mode = mode;
+                RLGL.Recording.draws[RLGL.Recording.drawCount].vertexCount = vertexCount;
+                RLGL.Recording.draws[RLGL.Recording.drawCount].vertexAlignment = 0;
+                RLGL.Recording.draws[RLGL.Recording.drawCount].textureId = batch->draws[i].textureId;
+                RLGL.Recording.drawCount++;
+            }
+        }
+
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+    }
+
+    RLGL.State.vertexCounter = 0;
+}
+
+// Transform vertex positions (2 or 3 components) by current transform matrix, output is always 3 components
+// NOTE: Using SSE/NEON when available, every vertex is multiplied in a single pass by the 4 matrix columns
+static void rlTransformVertexSpan(float *dst, const float *src, int components, float z, int count)
+{
+    int i = 0;
+
+    if (!RLGL.State.transformRequired)
+    {
+        if (components == 3) memcpy(dst, src, 3*count*sizeof(float));
+        else for (i = 0; i < count; i++) { dst[3*i] = src[2*i]; dst[3*i + 1] = src[2*i + 1]; dst[3*i + 2] = z; }
+
+        return;
+    }
+
+    Matrix mat = RLGL.State.transform;
+
+    // NOTE: SIMD results are stored as 4 floats, last one is overwritten by next vertex,
+    // so last vertex is always processed by scalar path to avoid writing out of the span
+#if defined(RLGL_SIMD_SSE)
+    __m128 col0 = _mm_setr_ps(mat.m0, mat.m1, mat.m2, mat.m3);
+    __m128 col1 = _mm_setr_ps(mat.m4, mat.m5, mat.m6, mat.m7);
+    __m128 col2 = _mm_setr_ps(mat.m8, mat.m9, mat.m10, mat.m11);
+    __m128 col3 = _mm_setr_ps(mat.m12, mat.m13, mat.m14, mat.m15);
+
+    for (; i < (count - 1); i++)
+    {
+        const float *v = src + components*i;
+        __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(v[0])), _mm_mul_ps(col1, _mm_set1_ps(v[1]))),
+                                   _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps((components == 3)? v[2] : z)), col3));
+        _mm_storeu_ps(dst + 3*i, result);
+    }
+#elif defined(RLGL_SIMD_NEON)
+    const float columns[16] = { mat.m0, mat.m1, mat.m2, mat.m3, mat.m4, mat.m5, mat.m6, mat.m7,
+                                mat.m8, mat.m9, mat.m10, mat.m11, mat.m12, mat.m13, mat.m14, mat.m15 };
+    float32x4_t col0 = vld1q_f32(columns);
+    float32x4_t col1 = vld1q_f32(columns + 4);
+    float32x4_t col2 = vld1q_f32(columns + 8);
+    float32x4_t col3 = vld1q_f32(columns + 12);
+
+    for (; i < (count - 1); i++)
+    {
+        const float *v = src + components*i;
+        float32x4_t result = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(col3, col0, v[0]), col1, v[1]), col2, (components == 3)? v[2] : z);
+        vst1q_f32(dst + 3*i, result);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const float *v = src + components*i;
+        float vz = (components == 3)? v[2] : z;
+
+        dst[3*i] = mat.m0*v[0] + mat.m4*v[1] + mat.m8*vz + mat.m12;
+        dst[3*i + 1] = mat.m1*v[0] + mat.m5*v[1] + mat.m9*vz + mat.m13;
+        dst[3*i + 2] = mat.m2*v[0] + mat.m6*v[1] + mat.m10*vz + mat.m14;
+    }
+}
+
+// Clear cached uniform values for shader locations (all locations if location is -1)
+static void rlClearUniformCache(unsigned int shaderId, int location, int count)
+{
+    for (int i = 0; i < RL_STATE_CACHE_UNIFORMS; i++)
+    {
+        if ((RLGL.Cache.uniforms[i].shaderId == shaderId) &&
+            ((location == -1) || ((RLGL.Cache.uniforms[i].location >= location) && (RLGL.Cache.uniforms[i].location < (location + count)))))
+        {
+            RLGL.Cache.uniforms[i].shaderId = 0;
+        }
+    }
+}
+
+// Load shader active uniforms locations into a table
+// NOTE: Array uniforms are registered with both names, "name[0]" and "name"
+static void rlLoadUniformTable(unsigned int shaderId)
+{
+    rlUnloadUniformTable(shaderId);     // Program ids could be reused, make sure table is clean
+
+    int uniformCount = 0;
+    int maxNameLength = 0;
+    glGetProgramiv(shaderId, GL_ACTIVE_UNIFORMS, &uniformCount);
+    glGetProgramiv(shaderId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+    if (RLGL.UniformTables.count >= RLGL.UniformTables.capacity)
+    {
+        RLGL.UniformTables.capacity += 32;
+        RLGL.UniformTables.tables = (rlUniformTable *)RL_REALLOC(RLGL.UniformTables.tables, RLGL.UniformTables.capacity*sizeof(rlUniformTable));
+    }
+
+    rlUniformTable *table = &RLGL.UniformTables.tables[RLGL.UniformTables.count];
+    RLGL.UniformTables.last = RLGL.UniformTables.count;
+    RLGL.UniformTables.count++;
+
+    // Table capacity: power of two, considering array base names are also registered
+    table->shaderId = shaderId;
+    table->capacity = 16;
+    while (table->capacity < uniformCount*4) table->capacity *= 2;
+    table->count = 0;
+    table->hashes = (unsigned int *)RL_CALLOC(table->capacity, sizeof(unsigned int));
+    table->locations = (int *)RL_CALLOC(table->capacity, sizeof(int));
+    table->names = (char **)RL_CALLOC(table->capacity, sizeof(char *));
+
+    char *name = (char *)RL_CALLOC(maxNameLength + 1, sizeof(char));
+
+    for (int i = 0; i < uniformCount; i++)
+    {
+        int nameLength = 0;
+        int size = 0;
+        unsigned int type = 0;
+        glGetActiveUniform(shaderId, i, maxNameLength + 1, &nameLength, &size, &type, name);
+
+        int location = glGetUniformLocation(shaderId, name);
+        *rlFindUniformTableEntry(table, name, true) = location;
+
+        // Register array base name
+        if ((nameLength > 3) && (strcmp(name + nameLength - 3, "[0]") == 0))
+        {
+            name[nameLength - 3] = '\0';
+            *rlFindUniformTableEntry(table, name, true) = location;
+        }
+    }
+
+    RL_FREE(name);
+
+    TRACELOG(RL_LOG_DEBUG, "SHADER: [ID %i] Active uniforms locations loaded: %i", shaderId, uniformCount);
+}
+
+// Unload shader uniforms locations table
+static void rlUnloadUniformTable(unsigned int shaderId)
+{
+    rlUniformTable *table = rlGetUniformTable(shaderId);
+
+    if (table != NULL)
+    {
+        for (int i = 0; i < table->capacity; i++) RL_FREE(table->names[i]);
+        RL_FREE(table->hashes);
+        RL_FREE(table->locations);
+        RL_FREE(table->names);
+
+        // Move last table to removed table position
+        *table = RLGL.UniformTables.tables[RLGL.UniformTables.count - 1];
+        RLGL.UniformTables.count--;
+        RLGL.UniformTables.last = 0;
+    }
+}
+
+// Get shader uniforms locations table (NULL if not loaded)
+static rlUniformTable *rlGetUniformTable(unsigned int shaderId)
+{
+    rlUniformTable *table = NULL;
+
+    if ((RLGL.UniformTables.last < RLGL.UniformTables.count) && (RLGL.UniformTables.tables[RLGL.UniformTables.last].shaderId == shaderId))
+    {
+        table = &RLGL.UniformTables.tables[RLGL.UniformTables.last];
+    }
+    else
+    {
+        for (int i = 0; i < RLGL.UniformTables.count; i++)
+        {
+            if (RLGL.UniformTables.tables[i].shaderId == shaderId)
+            {
+                table = &RLGL.UniformTables.tables[i];
+                RLGL.UniformTables.last = i;
+                break;
+            }
+        }
+    }
+
+    return table;
+}
+
+// Find uniform location entry by name, entry is created if not found and insert requested
+// NOTE: Returns NULL if not found and not inserted
+static int *rlFindUniformTableEntry(rlUniformTable *table, const char *uniformName, bool insert)
+{
+    if (uniformName == NULL) return NULL;
+
+    unsigned int hash = 2166136261u;    // FNV-1a hash
+    for (int i = 0; uniformName[i] != '\0'; i++) { hash ^= (unsigned char)uniformName[i]; hash *= 16777619u; }
+    if (hash == 0) hash = 1;            // Hash 0 reserved for empty slots
+
+    // Grow table if required, keeping load factor under 50%
+    if (insert && ((table->count + 1)*2 > table->capacity))
+    {
+        rlUniformTable grown = *table;
+        grown.capacity = table->capacity*2;
+        grown.count = 0;
+        grown.hashes = (unsigned int *)RL_CALLOC(grown.capacity, sizeof(unsigned int));
+        grown.locations = (int *)RL_CALLOC(grown.capacity, sizeof(int));
+        grown.names = (char **)RL_CALLOC(grown.capacity, sizeof(char *));
+
+        for (int i = 0; i < table->capacity; i++)
+        {
+            if (table->hashes[i] != 0)
+            {
+                int k = table->hashes[i]&(grown.capacity - 1);
+                while (grown.hashes[k] != 0) k = (k + 1)&(grown.capacity - 1);
+
+                grown.hashes[k] = table->hashes[i];
+                grown.locations[k] = table->locations[i];
+                grown.names[k] = table->names[i];
+                grown.count++;
+            }
+        }
+
+        RL_FREE(table->hashes);
+        RL_FREE(table->locations);
+        RL_FREE(table->names);
+        *table = grown;
+    }
+
+    int k = hash&(table->capacity - 1);
+
+    while (table->hashes[k] != 0)
+    {
+        if ((table->hashes[k] == hash) && (strcmp(table->names[k], uniformName) == 0)) return &table->locations[k];
+        k = (k + 1)&(table->capacity - 1);
+    }
+
+    if (!insert) return NULL;
+
+    int length = (int)strlen(uniformName);
+    table->hashes[k] = hash;
+    table->locations[k] = -1;
+    table->names[k] = (char *)RL_MALLOC(length + 1);
+    memcpy(table->names[k], uniformName, length + 1);
+    table->count++;
+
+    return &table->locations[k];
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -4933,6 +6626,72 @@ static const char *rlGetCompressedFormatName(int format)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+// Bind texture to active texture slot, filtering redundant binds with state cache
+static void rlBindTexture(unsigned int target, unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int *cached = NULL;
+
+    if (RLGL.Cache.activeTextureSlot < RL_STATE_CACHE_TEXTURE_SLOTS)
+    {
+        if (target == GL_TEXTURE_2D) cached = &RLGL.Cache.textureId[RLGL.Cache.activeTextureSlot];
+        else if (target == GL_TEXTURE_CUBE_MAP) cached = &RLGL.Cache.cubemapId[RLGL.Cache.activeTextureSlot];
+    }
+
+    if ((cached != NULL) && (*cached == id)) return;
+    if (cached != NULL) *cached = id;
+#endif
+
+    glBindTexture(target, id);
+    if (id != 0) rlStatsCurrent.textureBinds++;
+}
+
+// Enable/disable OpenGL capability, filtering redundant changes with state cache
+static void rlSetCapability(unsigned int capability, bool enabled)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int *cached = NULL;
+
+    switch (capability)
+    {
+        case GL_BLEND: cached = &RLGL.Cache.colorBlend; break;
+        case GL_DEPTH_TEST: cached = &RLGL.Cache.depthTest; break;
+        case GL_CULL_FACE: cached = &RLGL.Cache.backfaceCulling; break;
+        case GL_SCISSOR_TEST: cached = &RLGL.Cache.scissorTest; break;
+        default: break;
+    }
+
+    if ((cached != NULL) && (*cached == (unsigned int)enabled)) return;
+    if (cached != NULL) *cached = (unsigned int)enabled;
+#endif
+
+    if (enabled) glEnable(capability);
+    else glDisable(capability);
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || (defined(GRAPHICS_API_OPENGL_ES3) && !defined(PLATFORM_WEB))
+// Get hash of OpenGL driver vendor, renderer and version strings
+// NOTE: Used to validate driver dependant data, like shader program binaries
+static unsigned int rlGetDriverHash(void)
+{
+    unsigned int hash = 2166136261u;    // FNV-1a hash
+    const unsigned int names[3] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+
+    for (int i = 0; i < 3; i++)
+    {
+        const unsigned char *text = glGetString(names[i]);
+
+        for (int k = 0; (text != NULL) && (text[k] != '\0'); k++)
+        {
+            hash ^= text[k];
+            hash *= 16777619u;
+        }
+    }
+
+    return hash;
+}
+#endif
+
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
 static int rlGetPixelDataSize(int width, int height, int format)
@@ -4982,33 +6741,59 @@ static int rlGetPixelDataSize(int width, int height, int format)
     return dataSize;
 }
 
-// Auxiliar math functions
+// Flip screen pixel data vertically in-place, setting alpha component value to 255
+// NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it (no transparent image retrieval)
+static void rlFlipScreenPixels(unsigned char *pixels, int width, int height)
+{
+    const unsigned char alpha[4] = { 0, 0, 0, 255 };
+    unsigned int alphaMask = 0;
+    memcpy(&alphaMask, alpha, 4);   // NOTE: Endianness independent RGBA alpha mask
 
-// Get float array of matrix data
-static rl_float16 rlMatrixToFloatV(Matrix mat)
-{
-    rl_float16 result = { 0 };
-
-    result.v[0] = mat.m0;
-    result.v[1] = mat.m1;
-    result.v[2] = mat.m2;
-    result.v[3] = mat.m3;
-    result.v[4] = mat.m4;
-    result.v[5] = mat.m5;
-    result.v[6] = mat.m6;
-    result.v[7] = mat.m7;
-    result.v[8] = mat.m8;
-    result.v[9] = mat.m9;
-    result.v[10] = mat.m10;
-    result.v[11] = mat.m11;
-    result.v[12] = mat.m12;
-    result.v[13] = mat.m13;
-    result.v[14] = mat.m14;
-    result.v[15] = mat.m15;
+    int lineSize = width*4;
 
-    return result;
+    // Swap top and bottom lines, middle line is swapped with itself just to set alpha
+    for (int y = 0; y < (height + 1)/2; y++)
+    {
+        unsigned char *top = pixels + y*lineSize;
+        unsigned char *bottom = pixels + (height - 1 - y)*lineSize;
+        int x = 0;
+
+#if defined(RLGL_SIMD_SSE2)
+        const __m128i mask = _mm_set1_epi32((int)alphaMask);
+        for (; (x + 16) <= lineSize; x += 16)
+        {
+            __m128i topPixels = _mm_or_si128(_mm_loadu_si128((const __m128i *)(top + x)), mask);
+            __m128i bottomPixels = _mm_or_si128(_mm_loadu_si128((const __m128i *)(bottom + x)), mask);
+            _mm_storeu_si128((__m128i *)(top + x), bottomPixels);
+            _mm_storeu_si128((__m128i *)(bottom + x), topPixels);
+        }
+#elif defined(RLGL_SIMD_NEON)
+        const uint8x16_t mask = vreinterpretq_u8_u32(vdupq_n_u32(alphaMask));
+        for (; (x + 16) <= lineSize; x += 16)
+        {
+            uint8x16_t topPixels = vorrq_u8(vld1q_u8(top + x), mask);
+            uint8x16_t bottomPixels = vorrq_u8(vld1q_u8(bottom + x), mask);
+            vst1q_u8(top + x, bottomPixels);
+            vst1q_u8(bottom + x, topPixels);
+        }
+#endif
+        // Remaining pixels (or all pixels if SIMD not available)
+        for (; x < lineSize; x += 4)
+        {
+            unsigned int topPixel = 0;
+            unsigned int bottomPixel = 0;
+            memcpy(&topPixel, top + x, 4);
+            memcpy(&bottomPixel, bottom + x, 4);
+            topPixel |= alphaMask;
+            bottomPixel |= alphaMask;
+            memcpy(top + x, &bottomPixel, 4);
+            memcpy(bottom + x, &topPixel, 4);
+        }
+    }
 }
 
+// Auxiliar math functions
+
 // Get identity matrix
 static Matrix rlMatrixIdentity(void)
 {
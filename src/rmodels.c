@@ -136,7 +136,15 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh batch internal data
+typedef struct MeshBatchData {
+    unsigned int vboId[MAX_MESH_VERTEX_BUFFERS];    // Shared vertex buffers (same layout than mesh), indices are unsigned int
+    unsigned int drawIdsId;         // Draw index per instance buffer (instanced vertex attribute: vertexDrawId)
+    unsigned int transformsId;      // Draw transforms shader storage buffer (SSBO, binding = 0)
+    int drawCapacity;               // Number of draws supported by draw buffers
+    rlDrawElementsCommand *meshes;  // Meshes elements range in shared buffers
+    Shader shader;                  // Shader replacing default material shader on multi-draw indirect
+} MeshBatchData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -167,6 +175,9 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void SetMeshBatchDrawCapacity(MeshBatch batch, int capacity);   // Resize mesh batch draw buffers (multi-draw indirect)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1353,6 +1364,17 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
     else TRACELOG(LOG_INFO, "VBO: Mesh uploaded successfully to VRAM (GPU)");
 
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+    // Vertex data is uploaded to GPU and kept in CPU memory, animated meshes keep additional data in CPU memory
+    int vertexSize = 3*sizeof(float) + ((mesh->texcoords != NULL)? 2*sizeof(float) : 0) + ((mesh->normals != NULL)? 3*sizeof(float) : 0) +
+        ((mesh->colors != NULL)? 4*sizeof(unsigned char) : 0) + ((mesh->tangents != NULL)? 4*sizeof(float) : 0) + ((mesh->texcoords2 != NULL)? 2*sizeof(float) : 0);
+    int animVertexSize = ((mesh->animVertices != NULL)? 3*sizeof(float) : 0) + ((mesh->animNormals != NULL)? 3*sizeof(float) : 0) +
+        ((mesh->boneIds != NULL)? 4*sizeof(unsigned char) : 0) + ((mesh->boneWeights != NULL)? 4*sizeof(float) : 0);
+    int dataSize = mesh->vertexCount*vertexSize + ((mesh->indices != NULL)? mesh->triangleCount*3*sizeof(unsigned short) : 0);
+
+    REGISTER_RESOURCE(RESOURCE_MESH, mesh->vboId[0], (mesh->vaoId > 0)? mesh->vaoId : mesh->vboId[0], 0, dataSize, dataSize + mesh->vertexCount*animVertexSize, "UploadMesh");
+#endif
+
     rlDisableVertexArray();
 #endif
 }
@@ -1562,30 +1584,14 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         else rlDrawVertexArray(0, mesh.vertexCount);
     }
 
-    // Unbind all bound texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-    {
-        if (material.maps[i].texture.id > 0)
-        {
-            // Select current shader texture slot
-            rlActiveTextureSlot(i);
-
-            // Disable texture for active slot
-            if ((i == MATERIAL_MAP_IRRADIANCE) ||
-                (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
-            else rlDisableTexture();
-        }
-    }
+    // NOTE: Texture maps and shader program are kept bound, rlgl state cache
+    // filters redundant binds on next draw calls using the same material
 
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
     rlDisableVertexBufferElement();
 
-    // Disable shader program
-    rlDisableShader();
-
     // Restore rlgl internal modelview and projection matrices
     rlSetMatrixModelview(matView);
     rlSetMatrixProjection(matProjection);
@@ -1780,7 +1786,301 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
     }
 
-    // Unbind all bound texture maps
+    // NOTE: Texture maps and shader program are kept bound, rlgl state cache
+    // filters redundant binds on next draw calls using the same material
+
+    // Disable all possible vertex array objects (or VBOs)
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+
+    // Remove instance transforms buffer
+    rlUnloadVertexBuffer(instancesVboId);
+    RL_FREE(instanceTransforms);
+#endif
+}
+
+// Load mesh batch, meshes vertex data packed in shared GPU buffers
+// NOTE: Meshes must provide the same vertex attributes than first mesh, incompatible meshes are skipped,
+// meshes vertex data is copied, batch does not keep any reference to provided meshes
+MeshBatch LoadMeshBatch(const Mesh *meshes, int meshCount)
+{
+    MeshBatch batch = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((meshes == NULL) || (meshCount <= 0)) return batch;
+
+    MeshBatchData *data = (MeshBatchData *)RL_CALLOC(1, sizeof(MeshBatchData));
+    data->meshes = (rlDrawElementsCommand *)RL_CALLOC(meshCount, sizeof(rlDrawElementsCommand));
+
+    // Compute meshes elements range in shared buffers
+    for (int i = 0; i < meshCount; i++)
+    {
+        if ((meshes[i].vertices == NULL) ||
+            ((meshes[i].texcoords == NULL) != (meshes[0].texcoords == NULL)) ||
+            ((meshes[i].normals == NULL) != (meshes[0].normals == NULL)) ||
+            ((meshes[i].colors == NULL) != (meshes[0].colors == NULL)) ||
+            ((meshes[i].tangents == NULL) != (meshes[0].tangents == NULL)) ||
+            ((meshes[i].texcoords2 == NULL) != (meshes[0].texcoords2 == NULL)))
+        {
+            TRACELOG(LOG_WARNING, "MESH: [%i] Mesh vertex attributes not compatible with batch, mesh skipped", i);
+            continue;
+        }
+
+        data->meshes[i].count = (meshes[i].indices != NULL)? meshes[i].triangleCount*3 : meshes[i].vertexCount;
+        data->meshes[i].instanceCount = 1;
+        data->meshes[i].firstIndex = batch.indexCount;
+
+        batch.vertexCount += meshes[i].vertexCount;
+        batch.indexCount += data->meshes[i].count;
+    }
+
+    batch.meshCount = meshCount;
+
+    if (batch.vertexCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Mesh batch could not be loaded, no compatible meshes provided");
+        RL_FREE(data->meshes);
+        RL_FREE(data);
+        return (MeshBatch){ 0 };
+    }
+
+    // Pack meshes vertex data, indices are rebased to shared buffers (not indexed meshes get sequential indices)
+    // NOTE: Indices are stored as unsigned int, shared buffers can store more than 65535 vertex
+    float *vertices = (float *)RL_MALLOC(batch.vertexCount*3*sizeof(float));
+    float *texcoords = (meshes[0].texcoords != NULL)? (float *)RL_MALLOC(batch.vertexCount*2*sizeof(float)) : NULL;
+    float *normals = (meshes[0].normals != NULL)? (float *)RL_MALLOC(batch.vertexCount*3*sizeof(float)) : NULL;
+    unsigned char *colors = (meshes[0].colors != NULL)? (unsigned char *)RL_MALLOC(batch.vertexCount*4*sizeof(unsigned char)) : NULL;
+    float *tangents = (meshes[0].tangents != NULL)? (float *)RL_MALLOC(batch.vertexCount*4*sizeof(float)) : NULL;
+    float *texcoords2 = (meshes[0].texcoords2 != NULL)? (float *)RL_MALLOC(batch.vertexCount*2*sizeof(float)) : NULL;
+    unsigned int *indices = (unsigned int *)RL_MALLOC(batch.indexCount*sizeof(unsigned int));
+
+    for (int i = 0, vertexOffset = 0; i < meshCount; i++)
+    {
+        if (data->meshes[i].count == 0) continue;
+
+        int vertexCount = meshes[i].vertexCount;
+        const float *meshVertices = (meshes[i].animVertices != NULL)? meshes[i].animVertices : meshes[i].vertices;
+        const float *meshNormals = (meshes[i].animNormals != NULL)? meshes[i].animNormals : meshes[i].normals;
+
+        memcpy(vertices + vertexOffset*3, meshVertices, vertexCount*3*sizeof(float));
+        if (texcoords != NULL) memcpy(texcoords + vertexOffset*2, meshes[i].texcoords, vertexCount*2*sizeof(float));
+        if (normals != NULL) memcpy(normals + vertexOffset*3, meshNormals, vertexCount*3*sizeof(float));
+        if (colors != NULL) memcpy(colors + vertexOffset*4, meshes[i].colors, vertexCount*4*sizeof(unsigned char));
+        if (tangents != NULL) memcpy(tangents + vertexOffset*4, meshes[i].tangents, vertexCount*4*sizeof(float));
+        if (texcoords2 != NULL) memcpy(texcoords2 + vertexOffset*2, meshes[i].texcoords2, vertexCount*2*sizeof(float));
+
+        unsigned int *meshIndices = indices + data->meshes[i].firstIndex;
+        if (meshes[i].indices != NULL) for (unsigned int k = 0; k < data->meshes[i].count; k++) meshIndices[k] = vertexOffset + meshes[i].indices[k];
+        else for (unsigned int k = 0; k < data->meshes[i].count; k++) meshIndices[k] = vertexOffset + k;
+
+        vertexOffset += vertexCount;
+    }
+
+    // Upload shared buffers, vertex attributes use default locations (same as UploadMesh())
+    batch.vaoId = rlLoadVertexArray();
+    rlEnableVertexArray(batch.vaoId);
+
+    data->vboId[0] = rlLoadVertexBuffer(vertices, batch.vertexCount*3*sizeof(float), false);
+    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, 0, 0, 0);
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+
+    if (texcoords != NULL)
+    {
+        data->vboId[1] = rlLoadVertexBuffer(texcoords, batch.vertexCount*2*sizeof(float), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+    }
+    else rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+
+    if (normals != NULL)
+    {
+        data->vboId[2] = rlLoadVertexBuffer(normals, batch.vertexCount*3*sizeof(float), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+    }
+    else rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+
+    if (colors != NULL)
+    {
+        data->vboId[3] = rlLoadVertexBuffer(colors, batch.vertexCount*4*sizeof(unsigned char), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    }
+    else rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+
+    if (tangents != NULL)
+    {
+        data->vboId[4] = rlLoadVertexBuffer(tangents, batch.vertexCount*4*sizeof(float), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, 4, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+    }
+    else rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+
+    if (texcoords2 != NULL)
+    {
+        data->vboId[5] = rlLoadVertexBuffer(texcoords2, batch.vertexCount*2*sizeof(float), false);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, 2, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+    }
+    else rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+
+    data->vboId[6] = rlLoadVertexBufferElement(indices, batch.indexCount*sizeof(unsigned int), false);
+
+    batch.data = data;
+
+    // Multi-draw indirect requires per draw transforms in a shader storage buffer,
+    // default material shader is replaced by a shader reading them (indexed by vertexDrawId)
+    if (rlIsMultiDrawIndirectSupported())
+    {
+#if defined(GRAPHICS_API_OPENGL_43)
+        const char *batchVShaderCode =
+        "#version 430                       \n"
+        "in vec3 vertexPosition;            \n"
+        "in vec2 vertexTexCoord;            \n"
+        "in vec4 vertexColor;               \n"
+        "in float vertexDrawId;             \n"
+        "layout(std430, binding = 0) readonly buffer drawTransforms { mat4 transforms[]; }; \n"
+        "out vec2 fragTexCoord;             \n"
+        "out vec4 fragColor;                \n"
+        "uniform mat4 mvp;                  \n"    // NOTE: Model transform not included, read from draw transforms
+        "void main()                        \n"
+        "{                                  \n"
+        "    fragTexCoord = vertexTexCoord; \n"
+        "    fragColor = vertexColor;       \n"
+        "    gl_Position = mvp*transforms[int(vertexDrawId)]*vec4(vertexPosition, 1.0); \n"
+        "}                                  \n";
+
+        const char *batchFShaderCode =
+        "#version 430                       \n"
+        "in vec2 fragTexCoord;              \n"
+        "in vec4 fragColor;                 \n"
+        "out vec4 finalColor;               \n"
+        "uniform sampler2D texture0;        \n"
+        "uniform vec4 colDiffuse;           \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+        "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+        "}                                  \n";
+
+        data->shader = LoadShaderFromMemory(batchVShaderCode, batchFShaderCode);
+#endif
+        SetMeshBatchDrawCapacity(batch, meshCount);
+    }
+
+    rlDisableVertexArray();
+
+    RL_FREE(vertices);
+    RL_FREE(texcoords);
+    RL_FREE(normals);
+    RL_FREE(colors);
+    RL_FREE(tangents);
+    RL_FREE(texcoords2);
+    RL_FREE(indices);
+
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+    int vertexSize = 3*sizeof(float) + ((data->vboId[1] != 0)? 2*sizeof(float) : 0) + ((data->vboId[2] != 0)? 3*sizeof(float) : 0) +
+        ((data->vboId[3] != 0)? 4*sizeof(unsigned char) : 0) + ((data->vboId[4] != 0)? 4*sizeof(float) : 0) + ((data->vboId[5] != 0)? 2*sizeof(float) : 0);
+    REGISTER_RESOURCE(RESOURCE_MESH, data->vboId[0], batch.vaoId, 0, batch.vertexCount*vertexSize + batch.indexCount*(int)sizeof(unsigned int), 0, "LoadMeshBatch");
+#endif
+
+    TRACELOG(LOG_INFO, "MESH: [ID %i] Mesh batch loaded successfully to VRAM (GPU) [%i meshes, %i vertex, %i indices]", batch.vaoId, batch.meshCount, batch.vertexCount, batch.indexCount);
+#endif
+
+    return batch;
+}
+
+// Unload mesh batch from GPU memory (VRAM)
+void UnloadMeshBatch(MeshBatch batch)
+{
+    MeshBatchData *data = (MeshBatchData *)batch.data;
+    if (data == NULL) return;
+
+    UNREGISTER_RESOURCE(RESOURCE_MESH, data->vboId[0]);
+
+    rlUnloadVertexArray(batch.vaoId);
+    for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(data->vboId[i]);
+    rlUnloadVertexBuffer(data->drawIdsId);
+    rlUnloadShaderBuffer(data->transformsId);
+    if (data->shader.id > 0) UnloadShader(data->shader);
+
+    RL_FREE(data->meshes);
+    RL_FREE(data);
+
+    TRACELOG(LOG_INFO, "MESH: [ID %i] Mesh batch unloaded successfully from VRAM (GPU)", batch.vaoId);
+}
+
+// Draw batch meshes with material and transforms, meshIds[i] mesh drawn with transforms[i]
+// NOTE: With multi-draw indirect (OpenGL 4.3) all draws are submitted at once, transforms are read
+// from a shader storage buffer (binding = 0) indexed by vertexDrawId attribute and mvp uniform does not include
+// model transform, only default shader or shaders declaring vertexDrawId attribute are supported,
+// any other shader (or OpenGL version) draws meshes one by one, sharing buffers and material setup
+void DrawMeshBatch(MeshBatch batch, Material material, const int *meshIds, const Matrix *transforms, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    MeshBatchData *data = (MeshBatchData *)batch.data;
+    if ((data == NULL) || (meshIds == NULL) || (transforms == NULL) || (count <= 0)) return;
+
+    // Select shader to be used and submission method
+    Shader shader = material.shader;
+    bool multiDraw = false;
+
+    if (data->shader.id > 0)
+    {
+        if (shader.id == rlGetShaderIdDefault())
+        {
+            shader = data->shader;
+            multiDraw = true;
+        }
+        else multiDraw = (rlGetLocationAttrib(shader.id, "vertexDrawId") != -1);
+    }
+
+    // Resize draw buffers if required
+    // NOTE: Resizing binds and unbinds the batch VAO, it must be done before binding it for drawing
+    if (multiDraw && (count > data->drawCapacity)) SetMeshBatchDrawCapacity(batch, (count > 2*data->drawCapacity)? count : 2*data->drawCapacity);
+
+    // Bind shader program
+    rlEnableShader(shader.id);
+
+    // Send required data to shader (matrices, values)
+    //-----------------------------------------------------
+    // Upload to shader material.colDiffuse
+    if (shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
+        };
+
+        rlSetUniform(shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+    }
+
+    // Upload to shader material.colSpecular (if location available)
+    if (shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.r/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.g/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.b/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.a/255.0f
+        };
+
+        rlSetUniform(shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
+    }
+
+    Matrix matView = rlGetMatrixModelview();
+    Matrix matProjection = rlGetMatrixProjection();
+    Matrix matTransform = rlGetMatrixTransform();
+
+    // Upload view and projection matrices (if locations available)
+    if (shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
+    if (shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
+    //-----------------------------------------------------
+
+    // Bind active texture maps (if available)
     for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
         if (material.maps[i].texture.id > 0)
@@ -1788,31 +2088,151 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
             // Select current shader texture slot
             rlActiveTextureSlot(i);
 
-            // Disable texture for active slot
+            // Enable texture for active slot
             if ((i == MATERIAL_MAP_IRRADIANCE) ||
                 (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
-            else rlDisableTexture();
+                (i == MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
+            else rlEnableTexture(material.maps[i].texture.id);
+
+            rlSetUniform(shader.locs[SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
+        }
+    }
+
+    // Try binding vertex array objects (VAO) or use VBOs if not possible
+    if (!rlEnableVertexArray(batch.vaoId))
+    {
+        // Bind batch VBO data: vertex position (shader-location = 0)
+        rlEnableVertexBuffer(data->vboId[0]);
+        rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_POSITION]);
+
+        // Bind batch VBO data: vertex texcoords (shader-location = 1, if available)
+        if ((shader.locs[SHADER_LOC_VERTEX_TEXCOORD01] != -1) && (data->vboId[1] != 0))
+        {
+            rlEnableVertexBuffer(data->vboId[1]);
+            rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+        }
+
+        // Bind batch VBO data: vertex normals (shader-location = 2, if available)
+        if ((shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1) && (data->vboId[2] != 0))
+        {
+            rlEnableVertexBuffer(data->vboId[2]);
+            rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_NORMAL]);
         }
+
+        // Bind batch VBO data: vertex colors (shader-location = 3, if available)
+        if ((shader.locs[SHADER_LOC_VERTEX_COLOR] != -1) && (data->vboId[3] != 0))
+        {
+            rlEnableVertexBuffer(data->vboId[3]);
+            rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+            rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_COLOR]);
+        }
+
+        rlEnableVertexBufferElement(data->vboId[6]);
     }
 
+    if ((shader.locs[SHADER_LOC_VERTEX_COLOR] != -1) && (data->vboId[3] == 0))
+    {
+        // Set default value for vertex attribute expected by shader but not provided by batch
+        float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };    // WHITE
+        rlSetVertexAttributeDefault(shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_COLOR]);
+    }
+
+    // Get draw commands, baseInstance provides the draw index to shader (vertexDrawId)
+    rlDrawElementsCommand *commands = (rlDrawElementsCommand *)RL_MALLOC(count*sizeof(rlDrawElementsCommand));
+
+    for (int i = 0; i < count; i++)
+    {
+        if ((meshIds[i] >= 0) && (meshIds[i] < batch.meshCount)) commands[i] = data->meshes[meshIds[i]];
+        else commands[i] = (rlDrawElementsCommand){ 0 };
+
+        commands[i].baseInstance = i;
+    }
+
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+
+    if (multiDraw)
+    {
+        // Upload draw transforms, internal transform matrix (push/pop) is accumulated
+        float16 *drawTransforms = (float16 *)RL_MALLOC(count*sizeof(float16));
+        for (int i = 0; i < count; i++) drawTransforms[i] = MatrixToFloatV(MatrixMultiply(transforms[i], matTransform));
+
+        rlUpdateShaderBuffer(data->transformsId, drawTransforms, count*sizeof(float16), 0);
+        rlBindShaderBuffer(data->transformsId, 0);
+        RL_FREE(drawTransforms);
+
+        for (int eye = 0; eye < eyeCount; eye++)
+        {
+            // Calculate view-projection matrix, model transform is applied in shader
+            Matrix matViewProjection = MatrixIdentity();
+            if (eyeCount == 1) matViewProjection = MatrixMultiply(matView, matProjection);
+            else
+            {
+                // Setup current eye viewport (half screen width)
+                rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+                matViewProjection = MatrixMultiply(MatrixMultiply(matView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            }
+
+            rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_MVP], matViewProjection);
+
+            // Draw all meshes with a single submission
+            rlDrawVertexArrayElementsIndirect(commands, count);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (commands[i].count == 0) continue;
+
+            // Model transformation matrix is combined with internal transform matrix (push/pop)
+            Matrix matModel = MatrixMultiply(transforms[i], matTransform);
+            Matrix matModelView = MatrixMultiply(matModel, matView);
+
+            if (shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_MODEL], matModel);
+            if (shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+
+            for (int eye = 0; eye < eyeCount; eye++)
+            {
+                // Calculate model-view-projection matrix (MVP)
+                Matrix matModelViewProjection = MatrixIdentity();
+                if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+                else
+                {
+                    // Setup current eye viewport (half screen width)
+                    rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+                    matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+                }
+
+                rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+
+                // Draw mesh range from shared buffers
+                rlDrawVertexArrayElementsIndirect(&commands[i], 1);
+            }
+        }
+    }
+
+    RL_FREE(commands);
+
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
     rlDisableVertexBufferElement();
 
-    // Disable shader program
-    rlDisableShader();
-
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
+    // Restore viewport to default measures
+    if (eyeCount == 2) rlViewport(0, 0, rlGetFramebufferWidth(), rlGetFramebufferHeight());
 #endif
 }
 
 // Unload mesh from memory (RAM and VRAM)
 void UnloadMesh(Mesh mesh)
 {
+    if (mesh.vboId != NULL) UNREGISTER_RESOURCE(RESOURCE_MESH, mesh.vboId[0]);
+
     // Unload rlgl mesh vboId data
     rlUnloadVertexArray(mesh.vaoId);
 
@@ -4057,6 +4477,35 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Resize mesh batch draw buffers: draw index per instance buffer and draw transforms buffer
+// NOTE: Draw index is provided as a float vertex attribute, exact up to 2^24 draws
+static void SetMeshBatchDrawCapacity(MeshBatch batch, int capacity)
+{
+    MeshBatchData *data = (MeshBatchData *)batch.data;
+
+    float *drawIds = (float *)RL_MALLOC(capacity*sizeof(float));
+    for (int i = 0; i < capacity; i++) drawIds[i] = (float)i;
+
+    rlUnloadVertexBuffer(data->drawIdsId);
+    rlUnloadShaderBuffer(data->transformsId);
+
+    // Instanced vertex attribute, draws baseInstance select the draw index
+    rlEnableVertexArray(batch.vaoId);
+    data->drawIdsId = rlLoadVertexBuffer(drawIds, capacity*sizeof(float), false);
+    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_DRAWID, 1, RL_FLOAT, 0, 0, 0);
+    rlSetVertexAttributeDivisor(RL_DEFAULT_SHADER_ATTRIB_LOCATION_DRAWID, 1);
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_DRAWID);
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+
+    data->transformsId = rlLoadShaderBuffer(capacity*sizeof(float16), NULL, RL_DYNAMIC_DRAW);
+    data->drawCapacity = capacity;
+
+    RL_FREE(drawIds);
+}
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
@@ -55,9 +55,20 @@
 
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
-#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
+#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf(), ceilf(), fminf(), fmaxf()
 #include <float.h>      // Required for: FLT_EPSILON
-#include <stdlib.h>     // Required for: RL_FREE
+#include <stdlib.h>     // Required for: RL_FREE, qsort()
+#include <string.h>     // Required for: memcpy(), memset(), memmove()
+
+#if !defined(RLGL_DISABLE_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>  // Required for: SSE intrinsics [Used in CheckCollisionPoints*()]
+        #define SHAPES_SIMD_SSE
+    #elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (defined(__aarch64__) || defined(_M_ARM64))
+        #include <arm_neon.h>   // Required for: NEON intrinsics [Used in CheckCollisionPoints*()], vdivq_f32() requires AArch64
+        #define SHAPES_SIMD_NEON
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -70,11 +81,108 @@
 #ifndef SPLINE_SEGMENT_DIVISIONS
     #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions
 #endif
+#ifndef SPLINE_FLATTEN_TOLERANCE
+    #define SPLINE_FLATTEN_TOLERANCE    0.25f     // Spline path maximum flattening error in screen pixels
+#endif
+#ifndef SPLINE_FLATTEN_MAX_DEPTH
+    #define SPLINE_FLATTEN_MAX_DEPTH      16      // Spline path maximum subdivision depth per curve segment
+#endif
+#ifndef SPLINE_MITER_LIMIT
+    #define SPLINE_MITER_LIMIT          4.0f      // Spline path miter joins limit (miter length/half thickness), bevel used over limit
+#endif
+#ifndef MAX_CIRCLE_SEGMENTS
+    #define MAX_CIRCLE_SEGMENTS          512      // Maximum number of segments for circles
+#endif
+#ifndef MAX_CIRCLE_TABLES
+    #define MAX_CIRCLE_TABLES              4      // Maximum number of unit circle tables cached
+#endif
+#ifndef MAX_SHAPES_CHUNK_VERTEX
+    #define MAX_SHAPES_CHUNK_VERTEX     2048      // Maximum number of vertex per chunk on batched shapes drawing
+#endif
+
+// Broadphase proxies shapes
+#define BROADPHASE_PROXY_FREE              0      // Proxy not in use (removed)
+#define BROADPHASE_PROXY_RECTANGLE         1      // Rectangle proxy
+#define BROADPHASE_PROXY_CIRCLE            2      // Circle proxy, bounds contain circle bounding box
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Unit circle table, points of a circle arc with radius 1.0f
+typedef struct CircleTable {
+    float startAngle;                           // Arc start angle (degrees)
+    float endAngle;                             // Arc end angle (degrees)
+    int segments;                               // Arc segments, table contains (segments + 1) points
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];    // Unit circle points
+} CircleTable;
+
+// Shapes chunk, vertex data generated by batched shapes drawing (Draw*Batch())
+typedef struct ShapesChunk {
+    float vertices[2*MAX_SHAPES_CHUNK_VERTEX];  // Vertex position (XY - 2 components per vertex)
+    float texcoords[2*MAX_SHAPES_CHUNK_VERTEX]; // Vertex texture coordinates (UV - 2 components per vertex)
+    unsigned char colors[4*MAX_SHAPES_CHUNK_VERTEX]; // Vertex colors (RGBA - 4 components per vertex)
+    int vertexCount;                            // Vertex defined in chunk
+} ShapesChunk;
+
+// Spline stroke, spline path flattened polyline and stroke triangles being generated
+typedef struct SplineStroke {
+    Vector2 *points;                            // Flattened polyline points
+    int pointCount;                             // Flattened polyline points count
+    int pointCapacity;                          // Flattened polyline points allocated
+    float *vertices;                            // Stroke triangles vertex position (XY - 2 components per vertex)
+    int vertexCount;                            // Stroke triangles vertex count
+    int vertexCapacity;                         // Stroke triangles vertex allocated
+} SplineStroke;
+
+// Polygon node, polygon point linked in a ring, used on triangulation
+typedef struct PolygonNode {
+    int index;                                  // Point index on polygon mesh points
+    float x, y;                                 // Point position
+    int prev, next;                             // Previous and next nodes on ring
+} PolygonNode;
+
+// Broadphase proxy, rectangle or circle registered in broadphase
+typedef struct BroadphaseProxy {
+    int shape;                                  // Proxy shape: BROADPHASE_PROXY_*
+    Rectangle bounds;                           // Proxy bounds (circle bounding box for circles)
+    Vector2 center;                             // Circle center (circle proxies)
+    float radius;                               // Circle radius (circle proxies)
+    int cellMinX, cellMinY;                     // Grid cells range covered by bounds (min)
+    int cellMaxX, cellMaxY;                     // Grid cells range covered by bounds (max)
+    unsigned int queryStamp;                    // Last query testing proxy, avoids duplicates on multiple cells
+} BroadphaseProxy;
+
+// Broadphase grid entry, proxy registered on one grid cell
+typedef struct BroadphaseEntry {
+    int proxy;                                  // Proxy id
+    int cellX, cellY;                           // Grid cell
+    int next;                                   // Next entry on hash bucket or free list (-1 for none)
+} BroadphaseEntry;
+
+// Broadphase sort key, used on sweep-and-prune full sorting
+typedef struct BroadphaseSortKey {
+    float x;                                    // Proxy bounds min X
+    int id;                                     // Proxy id
+} BroadphaseSortKey;
+
+// Broadphase data, spatial hash grid and sweep-and-prune sorted list
+typedef struct BroadphaseData {
+    BroadphaseProxy *proxies;                   // Proxies, indexed by proxy id
+    int proxyCapacity;                          // Proxies allocated
+    int proxyTop;                               // Proxies ids used (free or not)
+    int *freeProxies;                           // Proxies ids removed, reused on next additions
+    int freeProxyCount;                         // Proxies ids removed count
+
+    int *buckets;                               // Grid hash buckets, first entry per bucket (-1 for empty)
+    int bucketCount;                            // Grid hash buckets count (power of two)
+    BroadphaseEntry *entries;                   // Grid entries pool
+    int entryCapacity;                          // Grid entries allocated
+    int freeEntry;                              // Grid entries free list first entry
+
+    int *sorted;                                // Proxies ids sorted by bounds min X (sweep-and-prune)
+    int sortedCount;                            // Proxies ids sorted count
+    unsigned int queryStamp;                    // Current query stamp
+} BroadphaseData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -82,10 +190,46 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (white pixel loaded by rlgl)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+static CircleTable circleTables[MAX_CIRCLE_TABLES] = { 0 };  // Unit circle tables cache, reused by consecutive circles
+static int circleTableNext = 0;                         // Next unit circle table to be replaced
+static ShapesChunk shapesChunk = { 0 };                 // Shapes chunk for batched shapes drawing
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static int GetCircleSegments(float radius, float arcAngle);         // Get circle arc segments required for current screen-space radius
+static const Vector2 *GetCircleTable(float startAngle, float endAngle, int segments); // Get unit circle table for a circle arc
+static void FlushShapesChunk(bool texcoords);                       // Submit shapes chunk vertex to current render batch
+static void TriangulatePolygonMesh(PolygonMesh *mesh);              // Triangulate polygon mesh (ear clipping)
+static int CreatePolygonRing(PolygonNode *nodes, int *nodeCount, const Vector2 *points, int start, int end, bool outline); // Create polygon nodes ring from points range
+static int InsertPolygonNode(PolygonNode *nodes, int *nodeCount, int index, Vector2 point, int last); // Insert polygon node after last node
+static void RemovePolygonNode(PolygonNode *nodes, int p);           // Remove polygon node from ring
+static int FilterPolygonNodes(PolygonNode *nodes, int start, int end); // Remove duplicate and collinear polygon nodes
+static float GetPolygonNodesArea(const PolygonNode *nodes, int p, int q, int r); // Get signed area of the triangle defined by polygon nodes
+static bool IsPointInPolygonTriangle(float ax, float ay, float bx, float by, float cx, float cy, float px, float py); // Check if point is inside triangle (edges included)
+static bool IsPolygonEar(const PolygonNode *nodes, int ear);         // Check if polygon node is an ear
+static bool IsPolygonLocallyInside(const PolygonNode *nodes, int a, int b); // Check if diagonal between polygon nodes is locally inside
+static int FindPolygonHoleBridge(const PolygonNode *nodes, int hole, int outer); // Find outline node to connect hole
+static int SplitPolygonNodes(PolygonNode *nodes, int *nodeCount, int a, int b); // Split polygon ring with a bridge between nodes
+static void AddSplineStrokePoint(SplineStroke *stroke, Vector2 point); // Add point to spline stroke polyline
+static void AddSplineStrokeTriangle(SplineStroke *stroke, Vector2 v1, Vector2 v2, Vector2 v3); // Add triangle to spline stroke
+static void AddSplineStrokeArc(SplineStroke *stroke, Vector2 center, Vector2 from, float angle, float halfThick, float tolerance); // Add arc to spline stroke
+static void FlattenSplineBezier(SplineStroke *stroke, Vector2 b0, Vector2 b1, Vector2 b2, Vector2 b3, float tolerance, int depth); // Flatten cubic bezier segment (adaptive subdivision)
+static void StrokeSplinePolyline(SplineStroke *stroke, float halfThick, int join, float tolerance); // Stroke spline polyline into triangles with joins
+static void GrowBroadphaseEntries(BroadphaseData *data, int capacity);  // Grow broadphase grid entries pool
+static int GetBroadphaseBucket(const BroadphaseData *data, int cellX, int cellY); // Get broadphase hash bucket for grid cell
+static void SetBroadphaseProxyCells(BroadphaseData *data, float cellSize, int id); // Set broadphase proxy grid cells range
+static void InsertBroadphaseCells(BroadphaseData *data, int id);    // Insert broadphase proxy in grid cells
+static void RemoveBroadphaseCells(BroadphaseData *data, int id);    // Remove broadphase proxy from grid cells
+static void SortBroadphaseProxies(BroadphaseData *data);            // Sort broadphase proxies for sweep-and-prune
+static int CompareBroadphaseSortKeys(const void *a, const void *b); // Compare broadphase sort keys, used by qsort()
+#if defined(SHAPES_SIMD_SSE) || defined(SHAPES_SIMD_NEON)
+static int StoreCollisionIndices(int mask, int first, int *indices, int count); // Store indices of colliding elements from a 4 lanes mask
+#endif
+#if defined(SHAPES_SIMD_NEON)
+static int GetCollisionMaskNeon(uint32x4_t result);                 // Get 4 lanes mask from NEON comparison result
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -279,10 +423,11 @@ void DrawCircle(int centerX, int centerY, float radius, Color color)
 // NOTE: On OpenGL 3.3 and ES2 we use QUADS to avoid drawing order issues
 void DrawCircleV(Vector2 center, float radius, Color color)
 {
-    DrawCircleSector(center, radius, 0, 360, 36, color);
+    DrawCircleSector(center, radius, 0, 360, 0, color);
 }
 
 // Draw a piece of a circle
+// NOTE: If segments is lower than required minimum, segments are calculated from screen-space radius
 void DrawCircleSector(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color)
 {
     if (radius <= 0.0f) radius = 0.1f;  // Avoid div by zero
@@ -298,17 +443,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
-    }
+    if (segments < minSegments) segments = GetCircleSegments(radius, endAngle - startAngle);
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *points = GetCircleTable(startAngle, endAngle, segments);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
@@ -325,15 +463,13 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2.0f))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2.0f))*radius);
+            rlVertex2f(center.x + points[2*i + 2].x*radius, center.y + points[2*i + 2].y*radius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + points[2*i + 1].x*radius, center.y + points[2*i + 1].y*radius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-            angle += (stepLength*2.0f);
+            rlVertex2f(center.x + points[2*i].x*radius, center.y + points[2*i].y*radius);
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -345,10 +481,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + points[segments].x*radius, center.y + points[segments].y*radius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[segments - 1].x*radius, center.y + points[segments - 1].y*radius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -364,10 +500,8 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
         }
     rlEnd();
 #endif
@@ -389,17 +523,10 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
-    }
+    if (segments < minSegments) segments = GetCircleSegments(radius, endAngle - startAngle);
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *points = GetCircleTable(startAngle, endAngle, segments);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
@@ -407,24 +534,22 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[0].x*radius, center.y + points[0].y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[segments].x*radius, center.y + points[segments].y*radius);
         }
     rlEnd();
 }
@@ -433,15 +558,18 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
+    int segments = GetCircleSegments(radius, 360.0f);
+    const Vector2 *points = GetCircleTable(0.0f, 360.0f, segments);
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color1.r, color1.g, color1.b, color1.a);
             rlVertex2f((float)centerX, (float)centerY);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radius, (float)centerY + sinf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f((float)centerX + points[i + 1].x*radius, (float)centerY + points[i + 1].y*radius);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radius, (float)centerY + sinf(DEG2RAD*i)*radius);
+            rlVertex2f((float)centerX + points[i].x*radius, (float)centerY + points[i].y*radius);
         }
     rlEnd();
 }
@@ -455,28 +583,34 @@ void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 // Draw circle outline (Vector version)
 void DrawCircleLinesV(Vector2 center, float radius, Color color)
 {
+    int segments = GetCircleSegments(radius, 360.0f);
+    const Vector2 *points = GetCircleTable(0.0f, 360.0f, segments);
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        // NOTE: Circle outline is drawn pixel by pixel every degree (0 to 360)
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
-            rlVertex2f(center.x + cosf(DEG2RAD*i)*radius, center.y + sinf(DEG2RAD*i)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(i + 10))*radius, center.y + sinf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
         }
     rlEnd();
 }
 
 // Draw ellipse
+// NOTE: Segments are calculated from the larger radius
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    int segments = GetCircleSegments((radiusH > radiusV)? radiusH : radiusV, 360.0f);
+    const Vector2 *points = GetCircleTable(0.0f, 360.0f, segments);
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f((float)centerX, (float)centerY);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radiusH, (float)centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radiusH, (float)centerY + sinf(DEG2RAD*i)*radiusV);
+            rlVertex2f((float)centerX + points[i + 1].x*radiusH, (float)centerY + points[i + 1].y*radiusV);
+            rlVertex2f((float)centerX + points[i].x*radiusH, (float)centerY + points[i].y*radiusV);
         }
     rlEnd();
 }
@@ -484,12 +618,15 @@ void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color c
 // Draw ellipse outline
 void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    int segments = GetCircleSegments((radiusH > radiusV)? radiusH : radiusV, 360.0f);
+    const Vector2 *points = GetCircleTable(0.0f, 360.0f, segments);
+
     rlBegin(RL_LINES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(centerX + cosf(DEG2RAD*(i + 10))*radiusH, centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f(centerX + cosf(DEG2RAD*i)*radiusH, centerY + sinf(DEG2RAD*i)*radiusV);
+            rlVertex2f(centerX + points[i + 1].x*radiusH, centerY + points[i + 1].y*radiusV);
+            rlVertex2f(centerX + points[i].x*radiusH, centerY + points[i].y*radiusV);
         }
     rlEnd();
 }
@@ -520,14 +657,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
-    }
+    if (segments < minSegments) segments = GetCircleSegments(outerRadius, endAngle - startAngle);
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
 
     // Not a ring
     if (innerRadius <= 0.0f)
@@ -536,8 +667,7 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *points = GetCircleTable(startAngle, endAngle, segments);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
@@ -549,18 +679,16 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + points[i].x*outerRadius, center.y + points[i].y*outerRadius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + points[i].x*innerRadius, center.y + points[i].y*innerRadius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + points[i + 1].x*outerRadius, center.y + points[i + 1].y*outerRadius);
         }
     rlEnd();
 
@@ -571,15 +699,13 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + points[i].x*innerRadius, center.y + points[i].y*innerRadius);
+            rlVertex2f(center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius);
+            rlVertex2f(center.x + points[i].x*outerRadius, center.y + points[i].y*outerRadius);
 
-            angle += stepLength;
+            rlVertex2f(center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius);
+            rlVertex2f(center.x + points[i + 1].x*outerRadius, center.y + points[i + 1].y*outerRadius);
+            rlVertex2f(center.x + points[i].x*outerRadius, center.y + points[i].y*outerRadius);
         }
     rlEnd();
 #endif
@@ -611,14 +737,8 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
-    }
+    if (segments < minSegments) segments = GetCircleSegments(outerRadius, endAngle - startAngle);
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
 
     if (innerRadius <= 0.0f)
     {
@@ -626,36 +746,33 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *points = GetCircleTable(startAngle, endAngle, segments);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + points[0].x*outerRadius, center.y + points[0].y*outerRadius);
+            rlVertex2f(center.x + points[0].x*innerRadius, center.y + points[0].y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + points[i].x*outerRadius, center.y + points[i].y*outerRadius);
+            rlVertex2f(center.x + points[i + 1].x*outerRadius, center.y + points[i + 1].y*outerRadius);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + points[i].x*innerRadius, center.y + points[i].y*innerRadius);
+            rlVertex2f(center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius);
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + points[segments].x*outerRadius, center.y + points[segments].y*outerRadius);
+            rlVertex2f(center.x + points[segments].x*innerRadius, center.y + points[segments].y*innerRadius);
         }
     rlEnd();
 }
@@ -723,38 +840,36 @@ void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
 
+    // Quad vertex: top-left, bottom-left, bottom-right, top-right
+    float vertices[8] = { topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y };
+    float texcoords[8] = {
+        shapeRect.x/texShapes.width, shapeRect.y/texShapes.height,
+        shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height,
+        (shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height,
+        (shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height
+    };
+
     rlBegin(RL_QUADS);
 
         rlNormal3f(0.0f, 0.0f, 1.0f);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(topLeft.x, topLeft.y);
-
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(bottomRight.x, bottomRight.y);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(topRight.x, topRight.y);
+        rlVertexTexCoord2fv(vertices, texcoords, 4);
 
     rlEnd();
 
     rlSetTexture(0);
 #else
+    float vertices[12] = {
+        topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, topRight.x, topRight.y,
+        topRight.x, topRight.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y
+    };
+
     rlBegin(RL_TRIANGLES);
 
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        rlVertex2f(topLeft.x, topLeft.y);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-        rlVertex2f(topRight.x, topRight.y);
-
-        rlVertex2f(topRight.x, topRight.y);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-        rlVertex2f(bottomRight.x, bottomRight.y);
+        rlVertex2fv(vertices, 6);
 
     rlEnd();
 #endif
@@ -875,15 +990,11 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     if (radius <= 0.0f) return;
 
     // Calculate number of segments to use for the corners
-    if (segments < 4)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/4.0f);
-        if (segments <= 0) segments = 4;
-    }
+    if (segments < 4) segments = GetCircleSegments(radius, 90.0f);
+    if (segments > MAX_CIRCLE_SEGMENTS/4) segments = MAX_CIRCLE_SEGMENTS/4;
 
-    float stepLength = 90.0f/(float)segments;
+    // NOTE: Corners points are taken from a full circle table, every corner uses one quarter
+    const Vector2 *points = GetCircleTable(0.0f, 360.0f, 4*segments);
 
     /*
     Quick sketch to make sense of all of this,
@@ -911,7 +1022,7 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     };
 
     const Vector2 centers[4] = { point[8], point[9], point[10], point[11] };
-    const float angles[4] = { 180.0f, 270.0f, 0.0f, 90.0f };
+    const int offsets[4] = { 2*segments, 3*segments, 0, segments };    // Corners start angles: 180, 270, 0, 90
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
@@ -921,7 +1032,7 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            const Vector2 *corner = points + offsets[k];
             const Vector2 center = centers[k];
 
             // NOTE: Every QUAD actually represents two segments
@@ -932,15 +1043,13 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
                 rlVertex2f(center.x, center.y);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2))*radius);
+                rlVertex2f(center.x + corner[2*i + 2].x*radius, center.y + corner[2*i + 2].y*radius);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + corner[2*i + 1].x*radius, center.y + corner[2*i + 1].y*radius);
 
                 rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-                angle += (stepLength*2);
+                rlVertex2f(center.x + corner[2*i].x*radius, center.y + corner[2*i].y*radius);
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -951,10 +1060,10 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
                 rlVertex2f(center.x, center.y);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + corner[segments].x*radius, center.y + corner[segments].y*radius);
 
                 rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + corner[segments - 1].x*radius, center.y + corner[segments - 1].y*radius);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
@@ -1024,15 +1133,14 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            const Vector2 *corner = points + offsets[k];
             const Vector2 center = centers[k];
             for (int i = 0; i < segments; i++)
             {
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-                angle += stepLength;
+                rlVertex2f(center.x + corner[i + 1].x*radius, center.y + corner[i + 1].y*radius);
+                rlVertex2f(center.x + corner[i].x*radius, center.y + corner[i].y*radius);
             }
         }
 
@@ -1110,15 +1218,11 @@ void DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, f
     if (radius <= 0.0f) return;
 
     // Calculate number of segments to use for the corners
-    if (segments < 4)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/2.0f);
-        if (segments <= 0) segments = 4;
-    }
+    if (segments < 4) segments = GetCircleSegments(radius + lineThick, 90.0f);
+    if (segments > MAX_CIRCLE_SEGMENTS/4) segments = MAX_CIRCLE_SEGMENTS/4;
 
-    float stepLength = 90.0f/(float)segments;
+    // NOTE: Corners points are taken from a full circle table, every corner uses one quarter
+    const Vector2 *points = GetCircleTable(0.0f, 360.0f, 4*segments);
     const float outerRadius = radius + lineThick, innerRadius = radius;
 
     /*
@@ -1152,7 +1256,7 @@ void DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, f
         {(float)(rec.x + rec.width) - innerRadius, (float)(rec.y + rec.height) - innerRadius}, {(float)rec.x + innerRadius, (float)(rec.y + rec.height) - innerRadius} // P18, P19
     };
 
-    const float angles[4] = { 180.0f, 270.0f, 0.0f, 90.0f };
+    const int offsets[4] = { 2*segments, 3*segments, 0, segments };    // Corners start angles: 180, 270, 0, 90
 
     if (lineThick > 1)
     {
@@ -1165,25 +1269,23 @@ void DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, f
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                const Vector2 *corner = points + offsets[k];
                 const Vector2 center = centers[k];
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
                     rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+                    rlVertex2f(center.x + corner[i].x*innerRadius, center.y + corner[i].y*innerRadius);
 
                     rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + corner[i + 1].x*innerRadius, center.y + corner[i + 1].y*innerRadius);
 
                     rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + corner[i + 1].x*outerRadius, center.y + corner[i + 1].y*outerRadius);
 
                     rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-                    angle += stepLength;
+                    rlVertex2f(center.x + corner[i].x*outerRadius, center.y + corner[i].y*outerRadius);
                 }
             }
 
@@ -1239,22 +1341,20 @@ void DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, f
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                const Vector2 *corner = points + offsets[k];
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + corner[i].x*innerRadius, center.y + corner[i].y*innerRadius);
+                    rlVertex2f(center.x + corner[i + 1].x*innerRadius, center.y + corner[i + 1].y*innerRadius);
+                    rlVertex2f(center.x + corner[i].x*outerRadius, center.y + corner[i].y*outerRadius);
 
-                    angle += stepLength;
+                    rlVertex2f(center.x + corner[i + 1].x*innerRadius, center.y + corner[i + 1].y*innerRadius);
+                    rlVertex2f(center.x + corner[i + 1].x*outerRadius, center.y + corner[i + 1].y*outerRadius);
+                    rlVertex2f(center.x + corner[i].x*outerRadius, center.y + corner[i].y*outerRadius);
                 }
             }
 
@@ -1304,15 +1404,14 @@ void DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, f
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                const Vector2 *corner = points + offsets[k];
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    rlVertex2f(center.x + corner[i].x*outerRadius, center.y + corner[i].y*outerRadius);
+                    rlVertex2f(center.x + corner[i + 1].x*outerRadius, center.y + corner[i + 1].y*outerRadius);
                 }
             }
 
@@ -1444,8 +1543,10 @@ void DrawTriangleStrip(const Vector2 *points, int pointCount, Color color)
 void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = rotation*DEG2RAD;
-    float angleStep = 360.0f/(float)sides*DEG2RAD;
+    if (sides > MAX_CIRCLE_SEGMENTS) sides = MAX_CIRCLE_SEGMENTS;
+
+    // Polygon vertices are the unit circle table points, starting at rotation angle
+    const Vector2 *points = GetCircleTable(rotation, rotation + 360.0f, sides);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
@@ -1455,21 +1556,18 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
         for (int i = 0; i < sides; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            float nextAngle = centralAngle + angleStep;
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-
-            centralAngle = nextAngle;
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
         }
     rlEnd();
     rlSetTexture(0);
@@ -1480,10 +1578,8 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-
-            centralAngle += angleStep;
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
         }
     rlEnd();
 #endif
@@ -1493,18 +1589,17 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
 void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = rotation*DEG2RAD;
-    float angleStep = 360.0f/(float)sides*DEG2RAD;
+    if (sides > MAX_CIRCLE_SEGMENTS) sides = MAX_CIRCLE_SEGMENTS;
+
+    const Vector2 *points = GetCircleTable(rotation, rotation + 360.0f, sides);
 
     rlBegin(RL_LINES);
         for (int i = 0; i < sides; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-            rlVertex2f(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
-
-            centralAngle += angleStep;
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
         }
     rlEnd();
 }
@@ -1512,7 +1607,9 @@ void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Colo
 void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, float lineThick, Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = rotation*DEG2RAD;
+    if (sides > MAX_CIRCLE_SEGMENTS) sides = MAX_CIRCLE_SEGMENTS;
+
+    const Vector2 *points = GetCircleTable(rotation, rotation + 360.0f, sides);
     float exteriorAngle = 360.0f/(float)sides*DEG2RAD;
     float innerRadius = radius - (lineThick*cosf(DEG2RAD*exteriorAngle/2.0f));
 
@@ -1524,21 +1621,18 @@ void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, fl
         for (int i = 0; i < sides; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            float nextAngle = centralAngle + exteriorAngle;
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
+            rlVertex2f(center.x + points[i].x*innerRadius, center.y + points[i].y*innerRadius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(nextAngle)*innerRadius, center.y + sinf(nextAngle)*innerRadius);
+            rlVertex2f(center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
-
-            centralAngle = nextAngle;
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
         }
     rlEnd();
     rlSetTexture(0);
@@ -1547,22 +1641,368 @@ void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, fl
         for (int i = 0; i < sides; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            float nextAngle = centralAngle + exteriorAngle;
 
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-            rlVertex2f(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
+            rlVertex2f(center.x + points[i].x*innerRadius, center.y + points[i].y*innerRadius);
+
+            rlVertex2f(center.x + points[i].x*innerRadius, center.y + points[i].y*innerRadius);
+            rlVertex2f(center.x + points[i + 1].x*innerRadius, center.y + points[i + 1].y*innerRadius);
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
+        }
+    rlEnd();
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Batched shapes functions
+//----------------------------------------------------------------------------------
+
+// Draw multiple color-filled rectangles, one color per rectangle
+// NOTE: Vertex are generated in chunks and submitted to current render batch with a single call per chunk
+void DrawRectanglesBatch(const Rectangle *recs, const Color *colors, int count)
+{
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    rlSetTexture(GetShapesTexture().id);
+    Rectangle shapeRect = GetShapesTextureRectangle();
+
+    // Quad texcoords: top-left, bottom-left, bottom-right, top-right
+    const float texcoords[8] = {
+        shapeRect.x/texShapes.width, shapeRect.y/texShapes.height,
+        shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height,
+        (shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height,
+        (shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height
+    };
+
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for (int i = 0; i < count; i++)
+        {
+            if ((shapesChunk.vertexCount + 4) > MAX_SHAPES_CHUNK_VERTEX) FlushShapesChunk(true);
+
+            Rectangle rec = recs[i];
+            float *vertex = shapesChunk.vertices + 2*shapesChunk.vertexCount;
+
+            vertex[0] = rec.x; vertex[1] = rec.y;
+            vertex[2] = rec.x; vertex[3] = rec.y + rec.height;
+            vertex[4] = rec.x + rec.width; vertex[5] = rec.y + rec.height;
+            vertex[6] = rec.x + rec.width; vertex[7] = rec.y;
+
+            memcpy(shapesChunk.texcoords + 2*shapesChunk.vertexCount, texcoords, 8*sizeof(float));
+            for (int k = 0; k < 4; k++) memcpy(shapesChunk.colors + 4*(shapesChunk.vertexCount + k), &colors[i], 4);
+
+            shapesChunk.vertexCount += 4;
+        }
+
+        FlushShapesChunk(true);
+
+    rlEnd();
+
+    rlSetTexture(0);
+#else
+    rlBegin(RL_TRIANGLES);
+
+        for (int i = 0; i < count; i++)
+        {
+            if ((shapesChunk.vertexCount + 6) > MAX_SHAPES_CHUNK_VERTEX) FlushShapesChunk(false);
+
+            Rectangle rec = recs[i];
+            float *vertex = shapesChunk.vertices + 2*shapesChunk.vertexCount;
+
+            vertex[0] = rec.x; vertex[1] = rec.y;
+            vertex[2] = rec.x; vertex[3] = rec.y + rec.height;
+            vertex[4] = rec.x + rec.width; vertex[5] = rec.y;
+            vertex[6] = rec.x + rec.width; vertex[7] = rec.y;
+            vertex[8] = rec.x; vertex[9] = rec.y + rec.height;
+            vertex[10] = rec.x + rec.width; vertex[11] = rec.y + rec.height;
+
+            for (int k = 0; k < 6; k++) memcpy(shapesChunk.colors + 4*(shapesChunk.vertexCount + k), &colors[i], 4);
+
+            shapesChunk.vertexCount += 6;
+        }
+
+        FlushShapesChunk(false);
+
+    rlEnd();
+#endif
+}
+
+// Draw multiple color-filled circles, one radius and color per circle
+// NOTE: Segments are calculated from screen-space radius, same as DrawCircleV()
+void DrawCirclesBatch(const Vector2 *centers, const float *radiuses, const Color *colors, int count)
+{
+    float segmentsRadius = -1.0f;
+    int segments = 0;
+    const Vector2 *points = NULL;
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    rlSetTexture(GetShapesTexture().id);
+    Rectangle shapeRect = GetShapesTextureRectangle();
+
+    // Quad texcoords, same as DrawCircleSector()
+    const float texcoords[8] = {
+        shapeRect.x/texShapes.width, shapeRect.y/texShapes.height,
+        (shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height,
+        (shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height,
+        shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height
+    };
+
+    rlBegin(RL_QUADS);
+
+        for (int i = 0; i < count; i++)
+        {
+            float radius = (radiuses[i] > 0.0f)? radiuses[i] : 0.1f;
+
+            // NOTE: Segments are only calculated when radius changes, even number required
+            // to fill QUADS with two segments each
+            if (radius != segmentsRadius)
+            {
+                segmentsRadius = radius;
+                segments = GetCircleSegments(radius, 360.0f);
+                segments += segments%2;
+                if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+                points = GetCircleTable(0.0f, 360.0f, segments);
+            }
+
+            if ((shapesChunk.vertexCount + 2*segments) > MAX_SHAPES_CHUNK_VERTEX) FlushShapesChunk(true);
+
+            Vector2 center = centers[i];
+            float *vertex = shapesChunk.vertices + 2*shapesChunk.vertexCount;
+
+            for (int k = 0; k < segments/2; k++, vertex += 8)
+            {
+                vertex[0] = center.x; vertex[1] = center.y;
+                vertex[2] = center.x + points[2*k + 2].x*radius; vertex[3] = center.y + points[2*k + 2].y*radius;
+                vertex[4] = center.x + points[2*k + 1].x*radius; vertex[5] = center.y + points[2*k + 1].y*radius;
+                vertex[6] = center.x + points[2*k].x*radius; vertex[7] = center.y + points[2*k].y*radius;
+
+                memcpy(shapesChunk.texcoords + 2*(shapesChunk.vertexCount + 4*k), texcoords, 8*sizeof(float));
+            }
+
+            for (int k = 0; k < 2*segments; k++) memcpy(shapesChunk.colors + 4*(shapesChunk.vertexCount + k), &colors[i], 4);
+
+            shapesChunk.vertexCount += 2*segments;
+        }
+
+        FlushShapesChunk(true);
+
+    rlEnd();
+
+    rlSetTexture(0);
+#else
+    rlBegin(RL_TRIANGLES);
+
+        for (int i = 0; i < count; i++)
+        {
+            float radius = (radiuses[i] > 0.0f)? radiuses[i] : 0.1f;
+
+            // NOTE: Segments are only calculated when radius changes
+            if (radius != segmentsRadius)
+            {
+                segmentsRadius = radius;
+                segments = GetCircleSegments(radius, 360.0f);
+                points = GetCircleTable(0.0f, 360.0f, segments);
+            }
+
+            if ((shapesChunk.vertexCount + 3*segments) > MAX_SHAPES_CHUNK_VERTEX) FlushShapesChunk(false);
+
+            Vector2 center = centers[i];
+            float *vertex = shapesChunk.vertices + 2*shapesChunk.vertexCount;
+
+            for (int k = 0; k < segments; k++, vertex += 6)
+            {
+                vertex[0] = center.x; vertex[1] = center.y;
+                vertex[2] = center.x + points[k + 1].x*radius; vertex[3] = center.y + points[k + 1].y*radius;
+                vertex[4] = center.x + points[k].x*radius; vertex[5] = center.y + points[k].y*radius;
+            }
+
+            for (int k = 0; k < 3*segments; k++) memcpy(shapesChunk.colors + 4*(shapesChunk.vertexCount + k), &colors[i], 4);
+
+            shapesChunk.vertexCount += 3*segments;
+        }
+
+        FlushShapesChunk(false);
+
+    rlEnd();
+#endif
+}
+
+// Draw multiple lines (using gl lines), one color per line
+// NOTE: Lines are defined by pairs of points: [start0, end0, start1, end1...], (2*count) points required
+void DrawLinesBatch(const Vector2 *points, const Color *colors, int count)
+{
+    rlBegin(RL_LINES);
+
+        for (int i = 0; i < count; i++)
+        {
+            if ((shapesChunk.vertexCount + 2) > MAX_SHAPES_CHUNK_VERTEX) FlushShapesChunk(false);
+
+            memcpy(shapesChunk.vertices + 2*shapesChunk.vertexCount, &points[2*i], 4*sizeof(float));
+            memcpy(shapesChunk.colors + 4*shapesChunk.vertexCount, &colors[i], 4);
+            memcpy(shapesChunk.colors + 4*(shapesChunk.vertexCount + 1), &colors[i], 4);
+
+            shapesChunk.vertexCount += 2;
+        }
+
+        FlushShapesChunk(false);
+
+    rlEnd();
+}
+
+// Draw multiple pixels, one color per pixel
+void DrawPixelsBatch(const Vector2 *positions, const Color *colors, int count)
+{
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    rlSetTexture(GetShapesTexture().id);
+    Rectangle shapeRect = GetShapesTextureRectangle();
+
+    // Quad texcoords: top-left, bottom-left, bottom-right, top-right
+    const float texcoords[8] = {
+        shapeRect.x/texShapes.width, shapeRect.y/texShapes.height,
+        shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height,
+        (shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height,
+        (shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height
+    };
+
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for (int i = 0; i < count; i++)
+        {
+            if ((shapesChunk.vertexCount + 4) > MAX_SHAPES_CHUNK_VERTEX) FlushShapesChunk(true);
+
+            Vector2 position = positions[i];
+            float *vertex = shapesChunk.vertices + 2*shapesChunk.vertexCount;
+
+            vertex[0] = position.x; vertex[1] = position.y;
+            vertex[2] = position.x; vertex[3] = position.y + 1;
+            vertex[4] = position.x + 1; vertex[5] = position.y + 1;
+            vertex[6] = position.x + 1; vertex[7] = position.y;
+
+            memcpy(shapesChunk.texcoords + 2*shapesChunk.vertexCount, texcoords, 8*sizeof(float));
+            for (int k = 0; k < 4; k++) memcpy(shapesChunk.colors + 4*(shapesChunk.vertexCount + k), &colors[i], 4);
+
+            shapesChunk.vertexCount += 4;
+        }
+
+        FlushShapesChunk(true);
+
+    rlEnd();
+
+    rlSetTexture(0);
+#else
+    rlBegin(RL_TRIANGLES);
 
-            rlVertex2f(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
-            rlVertex2f(center.x + cosf(nextAngle)*innerRadius, center.y + sinf(nextAngle)*innerRadius);
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
+        for (int i = 0; i < count; i++)
+        {
+            if ((shapesChunk.vertexCount + 6) > MAX_SHAPES_CHUNK_VERTEX) FlushShapesChunk(false);
+
+            Vector2 position = positions[i];
+            float *vertex = shapesChunk.vertices + 2*shapesChunk.vertexCount;
+
+            vertex[0] = position.x; vertex[1] = position.y;
+            vertex[2] = position.x; vertex[3] = position.y + 1;
+            vertex[4] = position.x + 1; vertex[5] = position.y;
+            vertex[6] = position.x + 1; vertex[7] = position.y;
+            vertex[8] = position.x; vertex[9] = position.y + 1;
+            vertex[10] = position.x + 1; vertex[11] = position.y + 1;
+
+            for (int k = 0; k < 6; k++) memcpy(shapesChunk.colors + 4*(shapesChunk.vertexCount + k), &colors[i], 4);
 
-            centralAngle = nextAngle;
+            shapesChunk.vertexCount += 6;
         }
+
+        FlushShapesChunk(false);
+
     rlEnd();
 #endif
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Polygon mesh functions
+//----------------------------------------------------------------------------------
+
+// Load polygon mesh from simple polygon points, triangulated on load
+// NOTE: Points contain the polygon outline followed by holes (optional),
+// holeIndices define the first point index of every hole, any winding order is supported
+PolygonMesh LoadPolygonMesh(const Vector2 *points, int pointCount, const int *holeIndices, int holeCount)
+{
+    PolygonMesh mesh = { 0 };
+
+    UpdatePolygonMesh(&mesh, points, pointCount, holeIndices, holeCount);
+
+    return mesh;
+}
+
+// Unload polygon mesh data
+void UnloadPolygonMesh(PolygonMesh mesh)
+{
+    RL_FREE(mesh.points);
+    RL_FREE(mesh.holes);
+    RL_FREE(mesh.indices);
+}
+
+// Update polygon mesh points, polygon is only triangulated again if points or holes changed
+void UpdatePolygonMesh(PolygonMesh *mesh, const Vector2 *points, int pointCount, const int *holeIndices, int holeCount)
+{
+    if ((points == NULL) || (pointCount < 0)) pointCount = 0;
+    if ((holeIndices == NULL) || (holeCount < 0)) holeCount = 0;
+
+    // Check if cached triangulation is still valid
+    if ((mesh->points != NULL) && (mesh->pointCount == pointCount) && (mesh->holeCount == holeCount) &&
+        ((pointCount == 0) || (memcmp(mesh->points, points, pointCount*sizeof(Vector2)) == 0)) &&
+        ((holeCount == 0) || (memcmp(mesh->holes, holeIndices, holeCount*sizeof(int)) == 0))) return;
+
+    if ((mesh->points == NULL) || (mesh->pointCount != pointCount) || (mesh->holeCount != holeCount))
+    {
+        // Maximum number of triangles, including holes bridges: (points + 2*holes - 2)
+        mesh->points = (Vector2 *)RL_REALLOC(mesh->points, (pointCount + 1)*sizeof(Vector2));
+        mesh->holes = (int *)RL_REALLOC(mesh->holes, (holeCount + 1)*sizeof(int));
+        mesh->indices = (int *)RL_REALLOC(mesh->indices, 3*(pointCount + 2*holeCount + 1)*sizeof(int));
+    }
+
+    mesh->pointCount = pointCount;
+    mesh->holeCount = holeCount;
+    if (pointCount > 0) memcpy(mesh->points, points, pointCount*sizeof(Vector2));
+    if (holeCount > 0) memcpy(mesh->holes, holeIndices, holeCount*sizeof(int));
+
+    TriangulatePolygonMesh(mesh);
+}
+
+// Draw polygon mesh triangles (color-filled), translated by position
+// NOTE: Cached triangles are streamed to current render batch in chunks
+void DrawPolygonMesh(PolygonMesh mesh, Vector2 position, Color color)
+{
+    if (mesh.triangleCount <= 0) return;
+
+    rlBegin(RL_TRIANGLES);
+
+        for (int i = 0; i < mesh.triangleCount; i++)
+        {
+            if ((shapesChunk.vertexCount + 3) > MAX_SHAPES_CHUNK_VERTEX) FlushShapesChunk(false);
+
+            float *vertex = shapesChunk.vertices + 2*shapesChunk.vertexCount;
+
+            for (int k = 0; k < 3; k++)
+            {
+                Vector2 point = mesh.points[mesh.indices[3*i + k]];
+
+                vertex[2*k] = point.x + position.x;
+                vertex[2*k + 1] = point.y + position.y;
+                memcpy(shapesChunk.colors + 4*(shapesChunk.vertexCount + k), &color, 4);
+            }
+
+            shapesChunk.vertexCount += 3;
+        }
+
+        FlushShapesChunk(false);
+
+    rlEnd();
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Splines functions
 //----------------------------------------------------------------------------------
@@ -2071,24 +2511,166 @@ void DrawSplineSegmentBezierCubic(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4
     DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
 }
 
-// Get spline point for a given t [0.0f .. 1.0f], Linear
-Vector2 GetSplinePointLinear(Vector2 startPos, Vector2 endPos, float t)
+// Load spline path, spline flattened and stroked for drawing (zoom 1.0f)
+// NOTE: Control points layout depends on spline type, same as DrawSpline*() functions
+SplinePath LoadSplinePath(int type, const Vector2 *points, int pointCount, float thick, int join)
 {
-    Vector2 point = { 0 };
+    SplinePath path = { 0 };
 
-    point.x = startPos.x*(1.0f - t) + endPos.x*t;
-    point.y = startPos.y*(1.0f - t) + endPos.y*t;
+    path.type = type;
+    path.join = join;
+    path.thick = thick;
 
-    return point;
+    UpdateSplinePath(&path, points, pointCount, 1.0f);
+
+    return path;
 }
 
-// Get spline point for a given t [0.0f .. 1.0f], B-Spline
-Vector2 GetSplinePointBasis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t)
+// Unload spline path data
+void UnloadSplinePath(SplinePath path)
 {
-    Vector2 point = { 0 };
+    RL_FREE(path.points);
+    RL_FREE(path.vertices);
+}
 
-    float a[4] = { 0 };
-    float b[4] = { 0 };
+// Update spline path control points and zoom (screen scale)
+// NOTE: Spline is only flattened again if control points changed or zoom changed significantly
+void UpdateSplinePath(SplinePath *path, const Vector2 *points, int pointCount, float zoom)
+{
+    if ((points == NULL) || (pointCount < 0)) pointCount = 0;
+    if (zoom <= 0.0f) zoom = 1.0f;
+
+    // Flattening error grows with zoom, up to 25% error increase is accepted before flattening again,
+    // zooming out wastes vertex so spline is flattened again when zoom is halved
+    bool zoomChanged = ((zoom > path->zoom*1.25f) || (zoom < path->zoom*0.5f));
+
+    if ((path->points != NULL) && !zoomChanged && (path->pointCount == pointCount) &&
+        ((pointCount == 0) || (memcmp(path->points, points, pointCount*sizeof(Vector2)) == 0))) return;
+
+    if ((path->points == NULL) || (path->pointCount != pointCount)) path->points = (Vector2 *)RL_REALLOC(path->points, (pointCount + 1)*sizeof(Vector2));
+
+    path->pointCount = pointCount;
+    path->zoom = zoom;
+    if (pointCount > 0) memcpy(path->points, points, pointCount*sizeof(Vector2));
+
+    // Flatten spline into a polyline, curves converted to cubic bezier segments
+    SplineStroke stroke = { 0 };
+    float tolerance = SPLINE_FLATTEN_TOLERANCE/zoom;
+
+    switch (path->type)
+    {
+        case SPLINE_LINEAR:
+        {
+            for (int i = 0; i < pointCount; i++) AddSplineStrokePoint(&stroke, points[i]);
+        } break;
+        case SPLINE_BASIS:
+        {
+            for (int i = 0; i < (pointCount - 3); i++)
+            {
+                Vector2 p1 = points[i], p2 = points[i + 1], p3 = points[i + 2], p4 = points[i + 3];
+
+                Vector2 b0 = { (p1.x + 4.0f*p2.x + p3.x)/6.0f, (p1.y + 4.0f*p2.y + p3.y)/6.0f };
+                Vector2 b1 = { (2.0f*p2.x + p3.x)/3.0f, (2.0f*p2.y + p3.y)/3.0f };
+                Vector2 b2 = { (p2.x + 2.0f*p3.x)/3.0f, (p2.y + 2.0f*p3.y)/3.0f };
+                Vector2 b3 = { (p2.x + 4.0f*p3.x + p4.x)/6.0f, (p2.y + 4.0f*p3.y + p4.y)/6.0f };
+
+                if (i == 0) AddSplineStrokePoint(&stroke, b0);
+                FlattenSplineBezier(&stroke, b0, b1, b2, b3, tolerance, 0);
+            }
+        } break;
+        case SPLINE_CATMULLROM:
+        {
+            for (int i = 0; i < (pointCount - 3); i++)
+            {
+                Vector2 p1 = points[i], p2 = points[i + 1], p3 = points[i + 2], p4 = points[i + 3];
+
+                Vector2 b1 = { p2.x + (p3.x - p1.x)/6.0f, p2.y + (p3.y - p1.y)/6.0f };
+                Vector2 b2 = { p3.x - (p4.x - p2.x)/6.0f, p3.y - (p4.y - p2.y)/6.0f };
+
+                if (i == 0) AddSplineStrokePoint(&stroke, p2);
+                FlattenSplineBezier(&stroke, p2, b1, b2, p3, tolerance, 0);
+            }
+        } break;
+        case SPLINE_BEZIER_QUADRATIC:
+        {
+            for (int i = 0; i < (pointCount - 2); i += 2)
+            {
+                Vector2 p1 = points[i], c2 = points[i + 1], p3 = points[i + 2];
+
+                Vector2 b1 = { p1.x + 2.0f/3.0f*(c2.x - p1.x), p1.y + 2.0f/3.0f*(c2.y - p1.y) };
+                Vector2 b2 = { p3.x + 2.0f/3.0f*(c2.x - p3.x), p3.y + 2.0f/3.0f*(c2.y - p3.y) };
+
+                if (i == 0) AddSplineStrokePoint(&stroke, p1);
+                FlattenSplineBezier(&stroke, p1, b1, b2, p3, tolerance, 0);
+            }
+        } break;
+        case SPLINE_BEZIER_CUBIC:
+        {
+            for (int i = 0; i < (pointCount - 3); i += 3)
+            {
+                if (i == 0) AddSplineStrokePoint(&stroke, points[0]);
+                FlattenSplineBezier(&stroke, points[i], points[i + 1], points[i + 2], points[i + 3], tolerance, 0);
+            }
+        } break;
+        default: break;
+    }
+
+    // Stroke polyline into triangles
+    StrokeSplinePolyline(&stroke, 0.5f*path->thick, path->join, tolerance);
+
+    RL_FREE(path->vertices);
+    path->vertices = stroke.vertices;
+    path->vertexCount = stroke.vertexCount;
+
+    RL_FREE(stroke.points);
+}
+
+// Draw spline path (color-filled stroke), cached triangles
+// NOTE: Cached triangles are streamed to current render batch in chunks
+void DrawSplinePath(SplinePath path, Color color)
+{
+    if (path.vertexCount <= 0) return;
+
+    // Chunk size multiple of 3, triangles are not split between chunks
+    const int chunkSize = 3*(MAX_SHAPES_CHUNK_VERTEX/3);
+    int colorCount = (path.vertexCount < chunkSize)? path.vertexCount : chunkSize;
+
+    rlBegin(RL_TRIANGLES);
+
+        // Same color for all vertex, set once for all chunks
+        for (int i = 0; i < colorCount; i++) memcpy(shapesChunk.colors + 4*i, &color, 4);
+
+        for (int i = 0; i < path.vertexCount; i += chunkSize)
+        {
+            int count = ((path.vertexCount - i) < chunkSize)? (path.vertexCount - i) : chunkSize;
+
+            memcpy(shapesChunk.vertices, path.vertices + 2*i, 2*count*sizeof(float));
+            shapesChunk.vertexCount = count;
+
+            FlushShapesChunk(false);
+        }
+
+    rlEnd();
+}
+
+// Get spline point for a given t [0.0f .. 1.0f], Linear
+Vector2 GetSplinePointLinear(Vector2 startPos, Vector2 endPos, float t)
+{
+    Vector2 point = { 0 };
+
+    point.x = startPos.x*(1.0f - t) + endPos.x*t;
+    point.y = startPos.y*(1.0f - t) + endPos.y*t;
+
+    return point;
+}
+
+// Get spline point for a given t [0.0f .. 1.0f], B-Spline
+Vector2 GetSplinePointBasis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float t)
+{
+    Vector2 point = { 0 };
+
+    float a[4] = { 0 };
+    float b[4] = { 0 };
 
     a[0] = (-p1.x + 3*p2.x - 3*p3.x + p4.x)/6.0f;
     a[1] = (3*p1.x - 6*p2.x + 3*p3.x)/6.0f;
@@ -2367,24 +2949,1389 @@ Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
     return overlap;
 }
 
+// Check collision between multiple points and rectangle, returns number of points inside
+// NOTE: Indices of points inside rectangle are stored in indices array (if not NULL), pointCount size required
+int CheckCollisionPointsRec(const Vector2 *points, int pointCount, Rectangle rec, int *indices)
+{
+    int count = 0;
+    int i = 0;
+
+#if defined(SHAPES_SIMD_SSE)
+    __m128 minX = _mm_set1_ps(rec.x);
+    __m128 minY = _mm_set1_ps(rec.y);
+    __m128 maxX = _mm_set1_ps(rec.x + rec.width);
+    __m128 maxY = _mm_set1_ps(rec.y + rec.height);
+
+    for (; i <= (pointCount - 4); i += 4)
+    {
+        __m128 a = _mm_loadu_ps((const float *)(points + i));
+        __m128 b = _mm_loadu_ps((const float *)(points + i + 2));
+        __m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(x, minX), _mm_cmplt_ps(x, maxX)),
+                                   _mm_and_ps(_mm_cmpge_ps(y, minY), _mm_cmplt_ps(y, maxY)));
+
+        count = StoreCollisionIndices(_mm_movemask_ps(inside), i, indices, count);
+    }
+#elif defined(SHAPES_SIMD_NEON)
+    float32x4_t minX = vdupq_n_f32(rec.x);
+    float32x4_t minY = vdupq_n_f32(rec.y);
+    float32x4_t maxX = vdupq_n_f32(rec.x + rec.width);
+    float32x4_t maxY = vdupq_n_f32(rec.y + rec.height);
+
+    for (; i <= (pointCount - 4); i += 4)
+    {
+        float32x4x2_t p = vld2q_f32((const float *)(points + i));
+
+        uint32x4_t inside = vandq_u32(vandq_u32(vcgeq_f32(p.val[0], minX), vcltq_f32(p.val[0], maxX)),
+                                      vandq_u32(vcgeq_f32(p.val[1], minY), vcltq_f32(p.val[1], maxY)));
+
+        count = StoreCollisionIndices(GetCollisionMaskNeon(inside), i, indices, count);
+    }
+#endif
+
+    for (; i < pointCount; i++)
+    {
+        if (CheckCollisionPointRec(points[i], rec))
+        {
+            if (indices != NULL) indices[count] = i;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Check collision between point and multiple rectangles, returns number of rectangles containing point
+// NOTE: Indices of rectangles containing point are stored in indices array (if not NULL), recCount size required
+int CheckCollisionPointRecs(Vector2 point, const Rectangle *recs, int recCount, int *indices)
+{
+    int count = 0;
+    int i = 0;
+
+#if defined(SHAPES_SIMD_SSE)
+    __m128 px = _mm_set1_ps(point.x);
+    __m128 py = _mm_set1_ps(point.y);
+
+    for (; i <= (recCount - 4); i += 4)
+    {
+        // Transpose 4 rectangles to get components vectors: x, y, width, height
+        __m128 x = _mm_loadu_ps((const float *)(recs + i));
+        __m128 y = _mm_loadu_ps((const float *)(recs + i + 1));
+        __m128 w = _mm_loadu_ps((const float *)(recs + i + 2));
+        __m128 h = _mm_loadu_ps((const float *)(recs + i + 3));
+        _MM_TRANSPOSE4_PS(x, y, w, h);
+
+        __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(px, x), _mm_cmplt_ps(px, _mm_add_ps(x, w))),
+                                   _mm_and_ps(_mm_cmpge_ps(py, y), _mm_cmplt_ps(py, _mm_add_ps(y, h))));
+
+        count = StoreCollisionIndices(_mm_movemask_ps(inside), i, indices, count);
+    }
+#elif defined(SHAPES_SIMD_NEON)
+    float32x4_t px = vdupq_n_f32(point.x);
+    float32x4_t py = vdupq_n_f32(point.y);
+
+    for (; i <= (recCount - 4); i += 4)
+    {
+        float32x4x4_t r = vld4q_f32((const float *)(recs + i));
+
+        uint32x4_t inside = vandq_u32(vandq_u32(vcgeq_f32(px, r.val[0]), vcltq_f32(px, vaddq_f32(r.val[0], r.val[2]))),
+                                      vandq_u32(vcgeq_f32(py, r.val[1]), vcltq_f32(py, vaddq_f32(r.val[1], r.val[3]))));
+
+        count = StoreCollisionIndices(GetCollisionMaskNeon(inside), i, indices, count);
+    }
+#endif
+
+    for (; i < recCount; i++)
+    {
+        if (CheckCollisionPointRec(point, recs[i]))
+        {
+            if (indices != NULL) indices[count] = i;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Check collision between multiple points and circle, returns number of points inside
+// NOTE: Indices of points inside circle are stored in indices array (if not NULL), pointCount size required
+int CheckCollisionPointsCircle(const Vector2 *points, int pointCount, Vector2 center, float radius, int *indices)
+{
+    int count = 0;
+    int i = 0;
+
+#if defined(SHAPES_SIMD_SSE)
+    __m128 cx = _mm_set1_ps(center.x);
+    __m128 cy = _mm_set1_ps(center.y);
+    __m128 radiusSq = _mm_set1_ps(radius*radius);
+
+    for (; i <= (pointCount - 4); i += 4)
+    {
+        __m128 a = _mm_loadu_ps((const float *)(points + i));
+        __m128 b = _mm_loadu_ps((const float *)(points + i + 2));
+        __m128 dx = _mm_sub_ps(cx, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128 dy = _mm_sub_ps(cy, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+
+        __m128 inside = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), radiusSq);
+
+        count = StoreCollisionIndices(_mm_movemask_ps(inside), i, indices, count);
+    }
+#elif defined(SHAPES_SIMD_NEON)
+    float32x4_t cx = vdupq_n_f32(center.x);
+    float32x4_t cy = vdupq_n_f32(center.y);
+    float32x4_t radiusSq = vdupq_n_f32(radius*radius);
+
+    for (; i <= (pointCount - 4); i += 4)
+    {
+        float32x4x2_t p = vld2q_f32((const float *)(points + i));
+        float32x4_t dx = vsubq_f32(cx, p.val[0]);
+        float32x4_t dy = vsubq_f32(cy, p.val[1]);
+
+        uint32x4_t inside = vcleq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)), radiusSq);
+
+        count = StoreCollisionIndices(GetCollisionMaskNeon(inside), i, indices, count);
+    }
+#endif
+
+    for (; i < pointCount; i++)
+    {
+        if (CheckCollisionPointCircle(points[i], center, radius))
+        {
+            if (indices != NULL) indices[count] = i;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Check collision between multiple points and polygon, returns number of points inside
+// NOTE: Indices of points inside polygon are stored in indices array (if not NULL), pointCount size required,
+// every polygon edge is tested against 4 points at once, same crossing test as CheckCollisionPointPoly()
+int CheckCollisionPointsPoly(const Vector2 *points, int pointCount, const Vector2 *polyPoints, int polyPointCount, int *indices)
+{
+    int count = 0;
+    int i = 0;
+
+    if (polyPointCount <= 2) return 0;
+
+#if defined(SHAPES_SIMD_SSE)
+    for (; i <= (pointCount - 4); i += 4)
+    {
+        __m128 a = _mm_loadu_ps((const float *)(points + i));
+        __m128 b = _mm_loadu_ps((const float *)(points + i + 2));
+        __m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        __m128 inside = _mm_setzero_ps();
+
+        for (int k = 0, j = polyPointCount - 1; k < polyPointCount; j = k++)
+        {
+            __m128 kx = _mm_set1_ps(polyPoints[k].x);
+            __m128 ky = _mm_set1_ps(polyPoints[k].y);
+            __m128 jy = _mm_set1_ps(polyPoints[j].y);
+
+            // NOTE: Division by zero on horizontal edges is discarded by the crossing mask
+            __m128 crossing = _mm_xor_ps(_mm_cmpgt_ps(ky, y), _mm_cmpgt_ps(jy, y));
+            __m128 edgeX = _mm_add_ps(_mm_div_ps(_mm_mul_ps(_mm_set1_ps(polyPoints[j].x - polyPoints[k].x), _mm_sub_ps(y, ky)), _mm_sub_ps(jy, ky)), kx);
+
+            inside = _mm_xor_ps(inside, _mm_and_ps(crossing, _mm_cmplt_ps(x, edgeX)));
+        }
+
+        count = StoreCollisionIndices(_mm_movemask_ps(inside), i, indices, count);
+    }
+#elif defined(SHAPES_SIMD_NEON)
+    for (; i <= (pointCount - 4); i += 4)
+    {
+        float32x4x2_t p = vld2q_f32((const float *)(points + i));
+        uint32x4_t inside = vdupq_n_u32(0);
+
+        for (int k = 0, j = polyPointCount - 1; k < polyPointCount; j = k++)
+        {
+            float32x4_t kx = vdupq_n_f32(polyPoints[k].x);
+            float32x4_t ky = vdupq_n_f32(polyPoints[k].y);
+            float32x4_t jy = vdupq_n_f32(polyPoints[j].y);
+
+            // NOTE: Division by zero on horizontal edges is discarded by the crossing mask
+            uint32x4_t crossing = veorq_u32(vcgtq_f32(ky, p.val[1]), vcgtq_f32(jy, p.val[1]));
+            float32x4_t edgeX = vaddq_f32(vdivq_f32(vmulq_f32(vdupq_n_f32(polyPoints[j].x - polyPoints[k].x), vsubq_f32(p.val[1], ky)), vsubq_f32(jy, ky)), kx);
+
+            inside = veorq_u32(inside, vandq_u32(crossing, vcltq_f32(p.val[0], edgeX)));
+        }
+
+        count = StoreCollisionIndices(GetCollisionMaskNeon(inside), i, indices, count);
+    }
+#endif
+
+    for (; i < pointCount; i++)
+    {
+        if (CheckCollisionPointPoly(points[i], polyPoints, polyPointCount))
+        {
+            if (indices != NULL) indices[count] = i;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Check collision between multiple circles and rectangle, returns number of circles colliding
+// NOTE: Indices of circles colliding with rectangle are stored in indices array (if not NULL), circleCount size required
+int CheckCollisionCirclesRec(const Vector2 *centers, const float *radiuses, int circleCount, Rectangle rec, int *indices)
+{
+    int count = 0;
+    int i = 0;
+
+#if defined(SHAPES_SIMD_SSE)
+    __m128 halfWidth = _mm_set1_ps(rec.width/2.0f);
+    __m128 halfHeight = _mm_set1_ps(rec.height/2.0f);
+    __m128 recCenterX = _mm_set1_ps(rec.x + rec.width/2.0f);
+    __m128 recCenterY = _mm_set1_ps(rec.y + rec.height/2.0f);
+    __m128 signMask = _mm_set1_ps(-0.0f);
+
+    for (; i <= (circleCount - 4); i += 4)
+    {
+        __m128 a = _mm_loadu_ps((const float *)(centers + i));
+        __m128 b = _mm_loadu_ps((const float *)(centers + i + 2));
+        __m128 radius = _mm_loadu_ps(radiuses + i);
+        __m128 dx = _mm_andnot_ps(signMask, _mm_sub_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), recCenterX));
+        __m128 dy = _mm_andnot_ps(signMask, _mm_sub_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)), recCenterY));
+
+        // Same tests as CheckCollisionCircleRec(): discard far circles, accept circles facing sides, test corners distance
+        __m128 near = _mm_and_ps(_mm_cmpngt_ps(dx, _mm_add_ps(halfWidth, radius)), _mm_cmpngt_ps(dy, _mm_add_ps(halfHeight, radius)));
+        __m128 sides = _mm_or_ps(_mm_cmple_ps(dx, halfWidth), _mm_cmple_ps(dy, halfHeight));
+        __m128 cornerX = _mm_sub_ps(dx, halfWidth);
+        __m128 cornerY = _mm_sub_ps(dy, halfHeight);
+        __m128 corner = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(cornerX, cornerX), _mm_mul_ps(cornerY, cornerY)), _mm_mul_ps(radius, radius));
+
+        count = StoreCollisionIndices(_mm_movemask_ps(_mm_and_ps(near, _mm_or_ps(sides, corner))), i, indices, count);
+    }
+#elif defined(SHAPES_SIMD_NEON)
+    float32x4_t halfWidth = vdupq_n_f32(rec.width/2.0f);
+    float32x4_t halfHeight = vdupq_n_f32(rec.height/2.0f);
+    float32x4_t recCenterX = vdupq_n_f32(rec.x + rec.width/2.0f);
+    float32x4_t recCenterY = vdupq_n_f32(rec.y + rec.height/2.0f);
+
+    for (; i <= (circleCount - 4); i += 4)
+    {
+        float32x4x2_t c = vld2q_f32((const float *)(centers + i));
+        float32x4_t radius = vld1q_f32(radiuses + i);
+        float32x4_t dx = vabsq_f32(vsubq_f32(c.val[0], recCenterX));
+        float32x4_t dy = vabsq_f32(vsubq_f32(c.val[1], recCenterY));
+
+        // Same tests as CheckCollisionCircleRec(): discard far circles, accept circles facing sides, test corners distance
+        uint32x4_t near = vandq_u32(vmvnq_u32(vcgtq_f32(dx, vaddq_f32(halfWidth, radius))), vmvnq_u32(vcgtq_f32(dy, vaddq_f32(halfHeight, radius))));
+        uint32x4_t sides = vorrq_u32(vcleq_f32(dx, halfWidth), vcleq_f32(dy, halfHeight));
+        float32x4_t cornerX = vsubq_f32(dx, halfWidth);
+        float32x4_t cornerY = vsubq_f32(dy, halfHeight);
+        uint32x4_t corner = vcleq_f32(vaddq_f32(vmulq_f32(cornerX, cornerX), vmulq_f32(cornerY, cornerY)), vmulq_f32(radius, radius));
+
+        count = StoreCollisionIndices(GetCollisionMaskNeon(vandq_u32(near, vorrq_u32(sides, corner))), i, indices, count);
+    }
+#endif
+
+    for (; i < circleCount; i++)
+    {
+        if (CheckCollisionCircleRec(centers[i], radiuses[i], rec))
+        {
+            if (indices != NULL) indices[count] = i;
+            count++;
+        }
+    }
+
+    return count;
+}
+
 //----------------------------------------------------------------------------------
-// Module specific Functions Definition
+// Module Functions Definition - Broadphase collision functions
 //----------------------------------------------------------------------------------
 
-// Cubic easing in-out
-// NOTE: Used by DrawLineBezier() only
-static float EaseCubicInOut(float t, float b, float c, float d)
+// Load broadphase spatial index for collision queries
+// NOTE: Cell size should be similar to the average proxy size, proxies covering
+// many cells are more expensive to update; capacity is grown if required
+Broadphase LoadBroadphase(float cellSize, int capacity)
 {
-    float result = 0.0f;
+    Broadphase broadphase = { 0 };
 
-    if ((t /= 0.5f*d) < 1) result = 0.5f*c*t*t*t + b;
+    if (cellSize <= 0.0f) cellSize = 64.0f;
+    if (capacity <= 0) capacity = 256;
+
+    BroadphaseData *data = (BroadphaseData *)RL_CALLOC(1, sizeof(BroadphaseData));
+
+    data->proxies = (BroadphaseProxy *)RL_CALLOC(capacity, sizeof(BroadphaseProxy));
+    data->freeProxies = (int *)RL_MALLOC(capacity*sizeof(int));
+    data->sorted = (int *)RL_MALLOC(capacity*sizeof(int));
+    data->proxyCapacity = capacity;
+
+    // Hash buckets count is a power of two, at least twice the expected proxies
+    data->bucketCount = 1;
+    while (data->bucketCount < 2*capacity) data->bucketCount *= 2;
+    data->buckets = (int *)RL_MALLOC(data->bucketCount*sizeof(int));
+    for (int i = 0; i < data->bucketCount; i++) data->buckets[i] = -1;
+
+    data->freeEntry = -1;
+    GrowBroadphaseEntries(data, 4*capacity);
+
+    broadphase.cellSize = cellSize;
+    broadphase.data = data;
+
+    return broadphase;
+}
+
+// Unload broadphase spatial index
+void UnloadBroadphase(Broadphase broadphase)
+{
+    BroadphaseData *data = (BroadphaseData *)broadphase.data;
+
+    if (data != NULL)
+    {
+        RL_FREE(data->proxies);
+        RL_FREE(data->freeProxies);
+        RL_FREE(data->sorted);
+        RL_FREE(data->buckets);
+        RL_FREE(data->entries);
+        RL_FREE(data);
+    }
+}
+
+// Add rectangle proxy to broadphase, returns proxy id
+int AddBroadphaseRec(Broadphase *broadphase, Rectangle rec)
+{
+    BroadphaseData *data = (BroadphaseData *)broadphase->data;
+    int id = 0;
+
+    if (data->freeProxyCount > 0) id = data->freeProxies[--data->freeProxyCount];
     else
     {
-        t -= 2;
-        result = 0.5f*c*(t*t*t + 2.0f) + b;
+        if (data->proxyTop >= data->proxyCapacity)
+        {
+            // Grow proxies arrays, ids are indices so they remain valid
+            int capacity = 2*data->proxyCapacity;
+            data->proxies = (BroadphaseProxy *)RL_REALLOC(data->proxies, capacity*sizeof(BroadphaseProxy));
+            data->freeProxies = (int *)RL_REALLOC(data->freeProxies, capacity*sizeof(int));
+            data->sorted = (int *)RL_REALLOC(data->sorted, capacity*sizeof(int));
+            memset(data->proxies + data->proxyCapacity, 0, (capacity - data->proxyCapacity)*sizeof(BroadphaseProxy));
+            data->proxyCapacity = capacity;
+        }
+
+        id = data->proxyTop++;
     }
 
-    return result;
+    BroadphaseProxy *proxy = &data->proxies[id];
+    memset(proxy, 0, sizeof(BroadphaseProxy));
+    proxy->shape = BROADPHASE_PROXY_RECTANGLE;
+    proxy->bounds = rec;
+
+    SetBroadphaseProxyCells(data, broadphase->cellSize, id);
+    InsertBroadphaseCells(data, id);
+
+    // NOTE: New proxies are appended, sorted on next GetBroadphasePairs()
+    data->sorted[data->sortedCount++] = id;
+    broadphase->proxyCount++;
+
+    return id;
+}
+
+// Add circle proxy to broadphase, returns proxy id
+int AddBroadphaseCircle(Broadphase *broadphase, Vector2 center, float radius)
+{
+    int id = AddBroadphaseRec(broadphase, (Rectangle){ center.x - radius, center.y - radius, 2*radius, 2*radius });
+
+    BroadphaseProxy *proxy = &((BroadphaseData *)broadphase->data)->proxies[id];
+    proxy->shape = BROADPHASE_PROXY_CIRCLE;
+    proxy->center = center;
+    proxy->radius = radius;
+
+    return id;
+}
+
+// Update rectangle proxy in broadphase
+void UpdateBroadphaseRec(Broadphase *broadphase, int id, Rectangle rec)
+{
+    BroadphaseData *data = (BroadphaseData *)broadphase->data;
+
+    if ((id < 0) || (id >= data->proxyTop) || (data->proxies[id].shape == BROADPHASE_PROXY_FREE)) return;
+
+    BroadphaseProxy *proxy = &data->proxies[id];
+    int cellMinX = proxy->cellMinX;
+    int cellMinY = proxy->cellMinY;
+    int cellMaxX = proxy->cellMaxX;
+    int cellMaxY = proxy->cellMaxY;
+
+    proxy->shape = BROADPHASE_PROXY_RECTANGLE;
+    proxy->bounds = rec;
+    SetBroadphaseProxyCells(data, broadphase->cellSize, id);
+
+    // Grid is only updated when proxy moves to different cells
+    if ((cellMinX != proxy->cellMinX) || (cellMinY != proxy->cellMinY) || (cellMaxX != proxy->cellMaxX) || (cellMaxY != proxy->cellMaxY))
+    {
+        BroadphaseProxy current = *proxy;
+
+        proxy->cellMinX = cellMinX;
+        proxy->cellMinY = cellMinY;
+        proxy->cellMaxX = cellMaxX;
+        proxy->cellMaxY = cellMaxY;
+        RemoveBroadphaseCells(data, id);
+
+        *proxy = current;
+        InsertBroadphaseCells(data, id);
+    }
+}
+
+// Update circle proxy in broadphase
+void UpdateBroadphaseCircle(Broadphase *broadphase, int id, Vector2 center, float radius)
+{
+    BroadphaseData *data = (BroadphaseData *)broadphase->data;
+
+    if ((id < 0) || (id >= data->proxyTop) || (data->proxies[id].shape == BROADPHASE_PROXY_FREE)) return;
+
+    UpdateBroadphaseRec(broadphase, id, (Rectangle){ center.x - radius, center.y - radius, 2*radius, 2*radius });
+
+    BroadphaseProxy *proxy = &data->proxies[id];
+    proxy->shape = BROADPHASE_PROXY_CIRCLE;
+    proxy->center = center;
+    proxy->radius = radius;
+}
+
+// Remove proxy from broadphase, proxy id could be reused by next added proxies
+void RemoveBroadphaseProxy(Broadphase *broadphase, int id)
+{
+    BroadphaseData *data = (BroadphaseData *)broadphase->data;
+
+    if ((id < 0) || (id >= data->proxyTop) || (data->proxies[id].shape == BROADPHASE_PROXY_FREE)) return;
+
+    RemoveBroadphaseCells(data, id);
+    data->proxies[id].shape = BROADPHASE_PROXY_FREE;
+
+    for (int i = 0; i < data->sortedCount; i++)
+    {
+        if (data->sorted[i] == id)
+        {
+            memmove(data->sorted + i, data->sorted + i + 1, (data->sortedCount - i - 1)*sizeof(int));
+            data->sortedCount--;
+            break;
+        }
+    }
+
+    data->freeProxies[data->freeProxyCount++] = id;
+    broadphase->proxyCount--;
+}
+
+// Query broadphase proxies colliding with rectangle, returns number of proxy ids stored (up to maxIds)
+// NOTE: Proxies found on grid cells are tested with CheckCollisionRecs() or CheckCollisionCircleRec()
+int QueryBroadphaseRec(Broadphase broadphase, Rectangle rec, int *ids, int maxIds)
+{
+    BroadphaseData *data = (BroadphaseData *)broadphase.data;
+    unsigned int stamp = ++data->queryStamp;
+    int count = 0;
+
+    int cellMinX = (int)floorf(rec.x/broadphase.cellSize);
+    int cellMinY = (int)floorf(rec.y/broadphase.cellSize);
+    int cellMaxX = (int)floorf((rec.x + rec.width)/broadphase.cellSize);
+    int cellMaxY = (int)floorf((rec.y + rec.height)/broadphase.cellSize);
+
+    for (int y = cellMinY; y <= cellMaxY; y++)
+    {
+        for (int x = cellMinX; x <= cellMaxX; x++)
+        {
+            for (int e = data->buckets[GetBroadphaseBucket(data, x, y)]; e != -1; e = data->entries[e].next)
+            {
+                BroadphaseEntry *entry = &data->entries[e];
+                BroadphaseProxy *proxy = &data->proxies[entry->proxy];
+
+                // Skip entries of other cells sharing bucket and proxies already tested
+                if ((entry->cellX != x) || (entry->cellY != y) || (proxy->queryStamp == stamp)) continue;
+                proxy->queryStamp = stamp;
+
+                bool collision = (proxy->shape == BROADPHASE_PROXY_CIRCLE)? CheckCollisionCircleRec(proxy->center, proxy->radius, rec) : CheckCollisionRecs(proxy->bounds, rec);
+
+                if (collision)
+                {
+                    if (count >= maxIds) return count;
+                    ids[count++] = entry->proxy;
+                }
+            }
+        }
+    }
+
+    return count;
 }
 
+// Query broadphase proxies containing point, returns number of proxy ids stored (up to maxIds)
+int QueryBroadphasePoint(Broadphase broadphase, Vector2 point, int *ids, int maxIds)
+{
+    BroadphaseData *data = (BroadphaseData *)broadphase.data;
+    int count = 0;
+
+    int x = (int)floorf(point.x/broadphase.cellSize);
+    int y = (int)floorf(point.y/broadphase.cellSize);
+
+    // NOTE: Proxies are only registered once per cell, no duplicates check required
+    for (int e = data->buckets[GetBroadphaseBucket(data, x, y)]; e != -1; e = data->entries[e].next)
+    {
+        BroadphaseEntry *entry = &data->entries[e];
+        BroadphaseProxy *proxy = &data->proxies[entry->proxy];
+
+        if ((entry->cellX != x) || (entry->cellY != y)) continue;
+
+        bool collision = (proxy->shape == BROADPHASE_PROXY_CIRCLE)? CheckCollisionPointCircle(point, proxy->center, proxy->radius) : CheckCollisionPointRec(point, proxy->bounds);
+
+        if (collision)
+        {
+            if (count >= maxIds) break;
+            ids[count++] = entry->proxy;
+        }
+    }
+
+    return count;
+}
+
+// Get broadphase colliding proxies pairs, returns number of pairs stored (up to maxPairs)
+// NOTE: Pairs are stored as consecutive proxy ids: [idA0, idB0, idA1, idB1...], (2*maxPairs) ids required.
+// Candidate pairs are found by sweep-and-prune on X axis and tested with CheckCollisionRecs(),
+// CheckCollisionCircles() or CheckCollisionCircleRec() depending on proxies shapes
+int GetBroadphasePairs(Broadphase broadphase, int *pairs, int maxPairs)
+{
+    BroadphaseData *data = (BroadphaseData *)broadphase.data;
+    int count = 0;
+
+    SortBroadphaseProxies(data);
+
+    for (int i = 0; i < data->sortedCount; i++)
+    {
+        const BroadphaseProxy *a = &data->proxies[data->sorted[i]];
+        float maxX = a->bounds.x + a->bounds.width;
+
+        for (int j = i + 1; j < data->sortedCount; j++)
+        {
+            const BroadphaseProxy *b = &data->proxies[data->sorted[j]];
+
+            if (b->bounds.x > maxX) break;      // Sorted proxies, no more overlaps on X axis
+            if ((b->bounds.y > (a->bounds.y + a->bounds.height)) || (a->bounds.y > (b->bounds.y + b->bounds.height))) continue;
+
+            bool collision = false;
+
+            if ((a->shape == BROADPHASE_PROXY_CIRCLE) && (b->shape == BROADPHASE_PROXY_CIRCLE)) collision = CheckCollisionCircles(a->center, a->radius, b->center, b->radius);
+            else if (a->shape == BROADPHASE_PROXY_CIRCLE) collision = CheckCollisionCircleRec(a->center, a->radius, b->bounds);
+            else if (b->shape == BROADPHASE_PROXY_CIRCLE) collision = CheckCollisionCircleRec(b->center, b->radius, a->bounds);
+            else collision = CheckCollisionRecs(a->bounds, b->bounds);
+
+            if (collision)
+            {
+                if (count >= maxPairs) return count;
+
+                pairs[2*count] = data->sorted[i];
+                pairs[2*count + 1] = data->sorted[j];
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Cubic easing in-out
+// NOTE: Used by DrawLineBezier() only
+static float EaseCubicInOut(float t, float b, float c, float d)
+{
+    float result = 0.0f;
+
+    if ((t /= 0.5f*d) < 1) result = 0.5f*c*t*t*t + b;
+    else
+    {
+        t -= 2;
+        result = 0.5f*c*(t*t*t + 2.0f) + b;
+    }
+
+    return result;
+}
+
+// Get circle arc segments required for current screen-space radius
+// NOTE: Radius is scaled by current modelview and transform matrices (i.e. Camera2D zoom),
+// segments are the minimum required to keep chords within SMOOTH_CIRCLE_ERROR_RATE pixels
+static int GetCircleSegments(float radius, float arcAngle)
+{
+    Matrix modelview = rlGetMatrixModelview();
+    Matrix transform = rlGetMatrixTransform();
+
+    // Scale factor from the 2d part of the matrices, square root of the area scale
+    float scale = sqrtf(fabsf(modelview.m0*modelview.m5 - modelview.m1*modelview.m4)*fabsf(transform.m0*transform.m5 - transform.m1*transform.m4));
+    float screenRadius = radius*scale;
+
+    int minSegments = (int)ceilf(arcAngle/90);
+    int segments = minSegments;
+
+    if (screenRadius > SMOOTH_CIRCLE_ERROR_RATE)
+    {
+        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
+        float th = 2.0f*acosf(1.0f - SMOOTH_CIRCLE_ERROR_RATE/screenRadius);
+        segments = (int)ceilf(arcAngle*DEG2RAD/th);
+    }
+
+    if (segments < minSegments) segments = minSegments;
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    return segments;
+}
+
+// Get unit circle table for a circle arc, (segments + 1) points
+// NOTE: Tables are cached, only two sinf()/cosf() pairs required to compute a new table,
+// returned points are valid until MAX_CIRCLE_TABLES different tables are requested
+static const Vector2 *GetCircleTable(float startAngle, float endAngle, int segments)
+{
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    for (int i = 0; i < MAX_CIRCLE_TABLES; i++)
+    {
+        if ((circleTables[i].segments == segments) && (circleTables[i].startAngle == startAngle) && (circleTables[i].endAngle == endAngle)) return circleTables[i].points;
+    }
+
+    CircleTable *table = &circleTables[circleTableNext];
+    circleTableNext = (circleTableNext + 1)%MAX_CIRCLE_TABLES;
+
+    table->startAngle = startAngle;
+    table->endAngle = endAngle;
+    table->segments = segments;
+
+    // Rotate first point by step angle to get the next ones
+    float stepLength = DEG2RAD*(endAngle - startAngle)/(float)segments;
+    float cosStep = cosf(stepLength);
+    float sinStep = sinf(stepLength);
+
+    table->points[0] = (Vector2){ cosf(DEG2RAD*startAngle), sinf(DEG2RAD*startAngle) };
+
+    for (int i = 1; i < segments; i++)
+    {
+        Vector2 point = table->points[i - 1];
+        table->points[i] = (Vector2){ point.x*cosStep - point.y*sinStep, point.x*sinStep + point.y*cosStep };
+    }
+
+    // NOTE: Last point is computed directly to avoid accumulated error on closed circles
+    table->points[segments] = (Vector2){ cosf(DEG2RAD*endAngle), sinf(DEG2RAD*endAngle) };
+
+    return table->points;
+}
+
+// Submit shapes chunk vertex to current render batch
+// NOTE: Render batch limits are checked once per chunk by rlVertexColor2fv()
+static void FlushShapesChunk(bool texcoords)
+{
+    if (shapesChunk.vertexCount > 0) rlVertexColor2fv(shapesChunk.vertices, texcoords? shapesChunk.texcoords : NULL, shapesChunk.colors, shapesChunk.vertexCount);
+
+    shapesChunk.vertexCount = 0;
+}
+
+// Triangulate polygon mesh (ear clipping), holes are connected to the outline by bridges first
+// NOTE: Triangles are stored counter-clockwise (screen-space), same order expected by DrawTriangle()
+static void TriangulatePolygonMesh(PolygonMesh *mesh)
+{
+    mesh->triangleCount = 0;
+
+    int outlineCount = (mesh->holeCount > 0)? mesh->holes[0] : mesh->pointCount;
+    if ((outlineCount < 3) || (outlineCount > mesh->pointCount)) return;
+
+    // Nodes required: all points + 2 nodes per hole bridge
+    PolygonNode *nodes = (PolygonNode *)RL_MALLOC((mesh->pointCount + 2*mesh->holeCount)*sizeof(PolygonNode));
+    int nodeCount = 0;
+
+    int outer = CreatePolygonRing(nodes, &nodeCount, mesh->points, 0, outlineCount, true);
+
+    if ((outer == -1) || (nodes[outer].next == nodes[outer].prev))
+    {
+        RL_FREE(nodes);
+        return;
+    }
+
+    if (mesh->holeCount > 0)
+    {
+        int *queue = (int *)RL_MALLOC(mesh->holeCount*sizeof(int));
+        int queueCount = 0;
+
+        for (int h = 0; h < mesh->holeCount; h++)
+        {
+            int start = mesh->holes[h];
+            int end = (h < (mesh->holeCount - 1))? mesh->holes[h + 1] : mesh->pointCount;
+
+            if ((start < outlineCount) || (end > mesh->pointCount) || (start >= end)) continue;
+
+            int ring = CreatePolygonRing(nodes, &nodeCount, mesh->points, start, end, false);
+            if ((ring == -1) || (ring == nodes[ring].next)) continue;
+
+            // Get hole leftmost node
+            int leftmost = ring;
+            int p = ring;
+
+            do
+            {
+                if ((nodes[p].x < nodes[leftmost].x) || ((nodes[p].x == nodes[leftmost].x) && (nodes[p].y < nodes[leftmost].y))) leftmost = p;
+                p = nodes[p].next;
+            } while (p != ring);
+
+            // Insert hole sorted by leftmost node position
+            int k = queueCount++;
+            while ((k > 0) && ((nodes[queue[k - 1]].x > nodes[leftmost].x) ||
+                   ((nodes[queue[k - 1]].x == nodes[leftmost].x) && (nodes[queue[k - 1]].y > nodes[leftmost].y))))
+            {
+                queue[k] = queue[k - 1];
+                k--;
+            }
+            queue[k] = leftmost;
+        }
+
+        // Connect holes to outline, from left to right
+        for (int h = 0; h < queueCount; h++)
+        {
+            int bridge = FindPolygonHoleBridge(nodes, queue[h], outer);
+
+            if (bridge != -1)
+            {
+                int bridgeReverse = SplitPolygonNodes(nodes, &nodeCount, bridge, queue[h]);
+
+                FilterPolygonNodes(nodes, bridgeReverse, nodes[bridgeReverse].next);
+                outer = FilterPolygonNodes(nodes, bridge, nodes[bridge].next);
+            }
+        }
+
+        RL_FREE(queue);
+    }
+
+    // Clip ears until a single triangle remains
+    int ear = outer;
+    int stop = ear;
+    bool filtered = false;
+
+    while (nodes[ear].prev != nodes[ear].next)
+    {
+        int prev = nodes[ear].prev;
+        int next = nodes[ear].next;
+
+        if (IsPolygonEar(nodes, ear))
+        {
+            mesh->indices[3*mesh->triangleCount] = nodes[prev].index;
+            mesh->indices[3*mesh->triangleCount + 1] = nodes[next].index;
+            mesh->indices[3*mesh->triangleCount + 2] = nodes[ear].index;
+            mesh->triangleCount++;
+
+            RemovePolygonNode(nodes, ear);
+
+            // Skipping next vertex leads to less sliver triangles
+            ear = nodes[next].next;
+            stop = ear;
+
+            continue;
+        }
+
+        ear = next;
+
+        if (ear == stop)
+        {
+            // No ears found on a full loop: remove duplicate and collinear points once and try again,
+            // if it still fails polygon is not simple (self-intersecting) and triangulation stops
+            if (filtered) break;
+
+            ear = FilterPolygonNodes(nodes, ear, -1);
+            stop = ear;
+            filtered = true;
+        }
+    }
+
+    RL_FREE(nodes);
+}
+
+// Create polygon nodes ring from points range, winding is set positive for outline and negative for holes
+// NOTE: Returns last node inserted, -1 if no points
+static int CreatePolygonRing(PolygonNode *nodes, int *nodeCount, const Vector2 *points, int start, int end, bool outline)
+{
+    float area = 0.0f;
+    int last = -1;
+
+    for (int i = start, j = end - 1; i < end; j = i++) area += (points[j].x - points[i].x)*(points[i].y + points[j].y);
+
+    if (outline == (area > 0.0f)) for (int i = start; i < end; i++) last = InsertPolygonNode(nodes, nodeCount, i, points[i], last);
+    else for (int i = end - 1; i >= start; i--) last = InsertPolygonNode(nodes, nodeCount, i, points[i], last);
+
+    // Remove closing point if it duplicates first point
+    if ((last != -1) && (nodes[last].x == nodes[nodes[last].next].x) && (nodes[last].y == nodes[nodes[last].next].y))
+    {
+        RemovePolygonNode(nodes, last);
+        last = nodes[last].next;
+    }
+
+    return last;
+}
+
+// Insert polygon node after last node, returns new node
+static int InsertPolygonNode(PolygonNode *nodes, int *nodeCount, int index, Vector2 point, int last)
+{
+    int p = (*nodeCount)++;
+
+    nodes[p].index = index;
+    nodes[p].x = point.x;
+    nodes[p].y = point.y;
+
+    if (last == -1)
+    {
+        nodes[p].prev = p;
+        nodes[p].next = p;
+    }
+    else
+    {
+        nodes[p].next = nodes[last].next;
+        nodes[p].prev = last;
+        nodes[nodes[last].next].prev = p;
+        nodes[last].next = p;
+    }
+
+    return p;
+}
+
+// Remove polygon node from ring, removed node keeps its links
+static void RemovePolygonNode(PolygonNode *nodes, int p)
+{
+    nodes[nodes[p].next].prev = nodes[p].prev;
+    nodes[nodes[p].prev].next = nodes[p].next;
+}
+
+// Remove duplicate and collinear polygon nodes between start and end nodes, returns end node
+static int FilterPolygonNodes(PolygonNode *nodes, int start, int end)
+{
+    if (end == -1) end = start;
+
+    int p = start;
+    bool again = false;
+
+    do
+    {
+        again = false;
+
+        if (((nodes[p].x == nodes[nodes[p].next].x) && (nodes[p].y == nodes[nodes[p].next].y)) ||
+            (GetPolygonNodesArea(nodes, nodes[p].prev, p, nodes[p].next) == 0.0f))
+        {
+            RemovePolygonNode(nodes, p);
+            p = end = nodes[p].prev;
+
+            if (p == nodes[p].next) break;
+            again = true;
+        }
+        else p = nodes[p].next;
+    } while (again || (p != end));
+
+    return end;
+}
+
+// Get signed area of the triangle defined by polygon nodes, negative for convex corners on outline winding
+static float GetPolygonNodesArea(const PolygonNode *nodes, int p, int q, int r)
+{
+    return (nodes[q].y - nodes[p].y)*(nodes[r].x - nodes[q].x) - (nodes[q].x - nodes[p].x)*(nodes[r].y - nodes[q].y);
+}
+
+// Check if point is inside triangle (edges included), triangle defined with outline winding
+static bool IsPointInPolygonTriangle(float ax, float ay, float bx, float by, float cx, float cy, float px, float py)
+{
+    return (((cx - px)*(ay - py) >= (ax - px)*(cy - py)) &&
+            ((ax - px)*(by - py) >= (bx - px)*(ay - py)) &&
+            ((bx - px)*(cy - py) >= (cx - px)*(by - py)));
+}
+
+// Check if polygon node is an ear: convex corner with no other reflex node inside its triangle
+static bool IsPolygonEar(const PolygonNode *nodes, int ear)
+{
+    const PolygonNode *a = &nodes[nodes[ear].prev];
+    const PolygonNode *b = &nodes[ear];
+    const PolygonNode *c = &nodes[nodes[ear].next];
+
+    if (GetPolygonNodesArea(nodes, nodes[ear].prev, ear, nodes[ear].next) >= 0.0f) return false;   // Reflex corner
+
+    // Triangle bounding box, used to discard nodes quickly
+    float minX = fminf(a->x, fminf(b->x, c->x));
+    float minY = fminf(a->y, fminf(b->y, c->y));
+    float maxX = fmaxf(a->x, fmaxf(b->x, c->x));
+    float maxY = fmaxf(a->y, fmaxf(b->y, c->y));
+
+    for (int p = c->next; p != nodes[ear].prev; p = nodes[p].next)
+    {
+        const PolygonNode *node = &nodes[p];
+
+        if ((node->x >= minX) && (node->x <= maxX) && (node->y >= minY) && (node->y <= maxY) &&
+            !((node->x == a->x) && (node->y == a->y)) &&
+            IsPointInPolygonTriangle(a->x, a->y, b->x, b->y, c->x, c->y, node->x, node->y) &&
+            (GetPolygonNodesArea(nodes, node->prev, p, node->next) >= 0.0f)) return false;
+    }
+
+    return true;
+}
+
+// Check if diagonal from node a to node b lies locally inside the polygon
+static bool IsPolygonLocallyInside(const PolygonNode *nodes, int a, int b)
+{
+    if (GetPolygonNodesArea(nodes, nodes[a].prev, a, nodes[a].next) < 0.0f)
+    {
+        return ((GetPolygonNodesArea(nodes, a, b, nodes[a].next) >= 0.0f) && (GetPolygonNodesArea(nodes, a, nodes[a].prev, b) >= 0.0f));
+    }
+    else return ((GetPolygonNodesArea(nodes, a, b, nodes[a].prev) < 0.0f) || (GetPolygonNodesArea(nodes, a, nodes[a].next, b) < 0.0f));
+}
+
+// Find outline node visible from hole leftmost node, used to connect hole to outline
+// NOTE: Based on David Eberly's algorithm: cast a ray to the left from hole and look for closest visible node
+static int FindPolygonHoleBridge(const PolygonNode *nodes, int hole, int outer)
+{
+    float hx = nodes[hole].x;
+    float hy = nodes[hole].y;
+    float qx = -INFINITY;
+    int m = -1;
+    int p = outer;
+
+    // Find outline segment intersected by the ray, closest to the hole
+    do
+    {
+        const PolygonNode *node = &nodes[p];
+        const PolygonNode *next = &nodes[node->next];
+
+        if ((hy <= node->y) && (hy >= next->y) && (next->y != node->y))
+        {
+            float x = node->x + (hy - node->y)*(next->x - node->x)/(next->y - node->y);
+
+            if ((x <= hx) && (x > qx))
+            {
+                qx = x;
+                m = (node->x < next->x)? p : node->next;
+
+                if (x == hx) return m;     // Hole touches outline segment, use its leftmost endpoint
+            }
+        }
+
+        p = node->next;
+    } while (p != outer);
+
+    if (m == -1) return -1;
+
+    // Segment endpoint could be hidden by other nodes inside the triangle defined by
+    // hole point, ray intersection and endpoint: use the node with minimum angle to the ray
+    int stop = m;
+    float mx = nodes[m].x;
+    float my = nodes[m].y;
+    float tanMin = INFINITY;
+
+    p = m;
+
+    do
+    {
+        const PolygonNode *node = &nodes[p];
+
+        if ((hx >= node->x) && (node->x >= mx) && (hx != node->x) &&
+            IsPointInPolygonTriangle((hy < my)? hx : qx, hy, mx, my, (hy < my)? qx : hx, hy, node->x, node->y))
+        {
+            float tan = fabsf(hy - node->y)/(hx - node->x);
+
+            if (IsPolygonLocallyInside(nodes, p, hole) &&
+                ((tan < tanMin) || ((tan == tanMin) && ((node->x > nodes[m].x) || ((node->x == nodes[m].x) &&
+                 (GetPolygonNodesArea(nodes, nodes[m].prev, m, node->prev) < 0.0f) && (GetPolygonNodesArea(nodes, node->next, m, nodes[m].next) < 0.0f))))))
+            {
+                m = p;
+                tanMin = tan;
+            }
+        }
+
+        p = node->next;
+    } while (p != stop);
+
+    return m;
+}
+
+// Split polygon ring with a bridge between nodes a and b, duplicating both nodes
+// NOTE: Returns duplicated b node, ring continues: a -> b ... b2 -> a2
+static int SplitPolygonNodes(PolygonNode *nodes, int *nodeCount, int a, int b)
+{
+    int a2 = (*nodeCount)++;
+    int b2 = (*nodeCount)++;
+    int an = nodes[a].next;
+    int bp = nodes[b].prev;
+
+    nodes[a2] = nodes[a];
+    nodes[b2] = nodes[b];
+
+    nodes[a].next = b;
+    nodes[b].prev = a;
+
+    nodes[a2].next = an;
+    nodes[an].prev = a2;
+
+    nodes[b2].next = a2;
+    nodes[a2].prev = b2;
+
+    nodes[bp].next = b2;
+    nodes[b2].prev = bp;
+
+    return b2;
+}
+
+// Add point to spline stroke polyline, duplicated consecutive points are discarded
+static void AddSplineStrokePoint(SplineStroke *stroke, Vector2 point)
+{
+    if ((stroke->pointCount > 0) && (stroke->points[stroke->pointCount - 1].x == point.x) && (stroke->points[stroke->pointCount - 1].y == point.y)) return;
+
+    if (stroke->pointCount >= stroke->pointCapacity)
+    {
+        stroke->pointCapacity = (stroke->pointCapacity > 0)? 2*stroke->pointCapacity : 64;
+        stroke->points = (Vector2 *)RL_REALLOC(stroke->points, stroke->pointCapacity*sizeof(Vector2));
+    }
+
+    stroke->points[stroke->pointCount++] = point;
+}
+
+// Add triangle to spline stroke, vertex reordered counter-clockwise (screen-space) if required
+static void AddSplineStrokeTriangle(SplineStroke *stroke, Vector2 v1, Vector2 v2, Vector2 v3)
+{
+    if (stroke->vertexCount + 3 > stroke->vertexCapacity)
+    {
+        stroke->vertexCapacity = (stroke->vertexCapacity > 0)? 2*stroke->vertexCapacity : 384;
+        stroke->vertices = (float *)RL_REALLOC(stroke->vertices, 2*stroke->vertexCapacity*sizeof(float));
+    }
+
+    if (((v2.x - v1.x)*(v3.y - v1.y) - (v2.y - v1.y)*(v3.x - v1.x)) > 0.0f)
+    {
+        Vector2 temp = v2;
+        v2 = v3;
+        v3 = temp;
+    }
+
+    float *vertex = stroke->vertices + 2*stroke->vertexCount;
+
+    vertex[0] = v1.x; vertex[1] = v1.y;
+    vertex[2] = v2.x; vertex[3] = v2.y;
+    vertex[4] = v3.x; vertex[5] = v3.y;
+
+    stroke->vertexCount += 3;
+}
+
+// Add arc to spline stroke as a triangle fan, rotating from point around center by angle (radians)
+static void AddSplineStrokeArc(SplineStroke *stroke, Vector2 center, Vector2 from, float angle, float halfThick, float tolerance)
+{
+    // Arc segments required to keep maximum error below tolerance
+    float maxStep = (tolerance < halfThick)? 2.0f*acosf(1.0f - tolerance/halfThick) : PI/2.0f;
+    int segments = (int)ceilf(fabsf(angle)/maxStep);
+
+    if (segments < 1) segments = 1;
+    if (segments > MAX_CIRCLE_SEGMENTS) segments = MAX_CIRCLE_SEGMENTS;
+
+    float stepCos = cosf(angle/segments);
+    float stepSin = sinf(angle/segments);
+    Vector2 radius = { from.x - center.x, from.y - center.y };
+    Vector2 previous = from;
+
+    for (int i = 0; i < segments; i++)
+    {
+        radius = (Vector2){ radius.x*stepCos - radius.y*stepSin, radius.x*stepSin + radius.y*stepCos };
+        Vector2 current = { center.x + radius.x, center.y + radius.y };
+
+        AddSplineStrokeTriangle(stroke, center, previous, current);
+        previous = current;
+    }
+}
+
+// Flatten cubic bezier segment with adaptive subdivision, points are added to stroke polyline (except first one)
+// NOTE: Flatness is estimated from control points distance to chord, segment is split at t = 0.5 until
+// maximum distance is below tolerance, straight segments require a single line
+static void FlattenSplineBezier(SplineStroke *stroke, Vector2 b0, Vector2 b1, Vector2 b2, Vector2 b3, float tolerance, int depth)
+{
+    float ux = 3.0f*b1.x - 2.0f*b0.x - b3.x;
+    float uy = 3.0f*b1.y - 2.0f*b0.y - b3.y;
+    float vx = 3.0f*b2.x - b0.x - 2.0f*b3.x;
+    float vy = 3.0f*b2.y - b0.y - 2.0f*b3.y;
+
+    ux *= ux;
+    uy *= uy;
+    vx *= vx;
+    vy *= vy;
+
+    if (ux < vx) ux = vx;
+    if (uy < vy) uy = vy;
+
+    if ((depth >= SPLINE_FLATTEN_MAX_DEPTH) || ((ux + uy) <= 16.0f*tolerance*tolerance))
+    {
+        AddSplineStrokePoint(stroke, b3);
+        return;
+    }
+
+    // Split segment using de Casteljau algorithm
+    Vector2 b01 = { (b0.x + b1.x)*0.5f, (b0.y + b1.y)*0.5f };
+    Vector2 b12 = { (b1.x + b2.x)*0.5f, (b1.y + b2.y)*0.5f };
+    Vector2 b23 = { (b2.x + b3.x)*0.5f, (b2.y + b3.y)*0.5f };
+    Vector2 b012 = { (b01.x + b12.x)*0.5f, (b01.y + b12.y)*0.5f };
+    Vector2 b123 = { (b12.x + b23.x)*0.5f, (b12.y + b23.y)*0.5f };
+    Vector2 mid = { (b012.x + b123.x)*0.5f, (b012.y + b123.y)*0.5f };
+
+    FlattenSplineBezier(stroke, b0, b01, b012, mid, tolerance, depth + 1);
+    FlattenSplineBezier(stroke, mid, b123, b23, b3, tolerance, depth + 1);
+}
+
+// Stroke spline polyline into triangles, with joins between segments
+// NOTE: Smooth joins (join geometry error below tolerance) share vertex between segments, no join geometry required,
+// round joins also add round caps at polyline ends
+static void StrokeSplinePolyline(SplineStroke *stroke, float halfThick, int join, float tolerance)
+{
+    if ((stroke->pointCount < 2) || (halfThick <= 0.0f)) return;
+
+    const Vector2 *points = stroke->points;
+    int pointCount = stroke->pointCount;
+
+    // Segment direction and normal
+    Vector2 direction = { points[1].x - points[0].x, points[1].y - points[0].y };
+    float length = sqrtf(direction.x*direction.x + direction.y*direction.y);
+    direction.x /= length;
+    direction.y /= length;
+    Vector2 normal = { -direction.y, direction.x };
+
+    Vector2 startLeft = { points[0].x + normal.x*halfThick, points[0].y + normal.y*halfThick };
+    Vector2 startRight = { points[0].x - normal.x*halfThick, points[0].y - normal.y*halfThick };
+
+    if (join == SPLINE_JOIN_ROUND) AddSplineStrokeArc(stroke, points[0], startLeft, PI, halfThick, tolerance);
+
+    for (int i = 0; i < (pointCount - 1); i++)
+    {
+        Vector2 point = points[i + 1];
+
+        if (i == (pointCount - 2))
+        {
+            Vector2 endLeft = { point.x + normal.x*halfThick, point.y + normal.y*halfThick };
+            Vector2 endRight = { point.x - normal.x*halfThick, point.y - normal.y*halfThick };
+
+            AddSplineStrokeTriangle(stroke, startLeft, startRight, endLeft);
+            AddSplineStrokeTriangle(stroke, endLeft, startRight, endRight);
+
+            if (join == SPLINE_JOIN_ROUND) AddSplineStrokeArc(stroke, point, endRight, PI, halfThick, tolerance);
+            break;
+        }
+
+        Vector2 nextDirection = { points[i + 2].x - point.x, points[i + 2].y - point.y };
+        length = sqrtf(nextDirection.x*nextDirection.x + nextDirection.y*nextDirection.y);
+        nextDirection.x /= length;
+        nextDirection.y /= length;
+        Vector2 nextNormal = { -nextDirection.y, nextDirection.x };
+
+        // Miter direction and half angle cosine between segments
+        Vector2 miter = { normal.x + nextNormal.x, normal.y + nextNormal.y };
+        float miterLength = sqrtf(miter.x*miter.x + miter.y*miter.y);
+        float halfCos = 0.5f*miterLength;
+
+        bool shared = false;
+
+        if (halfCos > 0.0001f)
+        {
+            if ((join == SPLINE_JOIN_MITER) && ((1.0f/halfCos) <= SPLINE_MITER_LIMIT)) shared = true;
+            else if ((halfThick*(1.0f/halfCos - 1.0f)) <= tolerance) shared = true;
+        }
+
+        if (shared)
+        {
+            float scale = halfThick/(halfCos*miterLength);
+            Vector2 endLeft = { point.x + miter.x*scale, point.y + miter.y*scale };
+            Vector2 endRight = { point.x - miter.x*scale, point.y - miter.y*scale };
+
+            AddSplineStrokeTriangle(stroke, startLeft, startRight, endLeft);
+            AddSplineStrokeTriangle(stroke, endLeft, startRight, endRight);
+
+            startLeft = endLeft;
+            startRight = endRight;
+        }
+        else
+        {
+            Vector2 endLeft = { point.x + normal.x*halfThick, point.y + normal.y*halfThick };
+            Vector2 endRight = { point.x - normal.x*halfThick, point.y - normal.y*halfThick };
+            Vector2 nextLeft = { point.x + nextNormal.x*halfThick, point.y + nextNormal.y*halfThick };
+            Vector2 nextRight = { point.x - nextNormal.x*halfThick, point.y - nextNormal.y*halfThick };
+
+            AddSplineStrokeTriangle(stroke, startLeft, startRight, endLeft);
+            AddSplineStrokeTriangle(stroke, endLeft, startRight, endRight);
+
+            // Join geometry on the outer side of the turn
+            float cross = direction.x*nextDirection.y - direction.y*nextDirection.x;
+            Vector2 outerFrom = (cross > 0.0f)? endRight : endLeft;
+            Vector2 outerTo = (cross > 0.0f)? nextRight : nextLeft;
+
+            if (join == SPLINE_JOIN_ROUND)
+            {
+                float dot = normal.x*nextNormal.x + normal.y*nextNormal.y;
+                float angle = acosf((dot > 1.0f)? 1.0f : ((dot < -1.0f)? -1.0f : dot));
+
+                AddSplineStrokeArc(stroke, point, outerFrom, (cross > 0.0f)? angle : -angle, halfThick, tolerance);
+            }
+            else AddSplineStrokeTriangle(stroke, point, outerFrom, outerTo);   // Bevel, also used for miters over limit
+
+            startLeft = nextLeft;
+            startRight = nextRight;
+        }
+
+        direction = nextDirection;
+        normal = nextNormal;
+    }
+}
+
+// Grow broadphase grid entries pool, new entries are added to free list
+static void GrowBroadphaseEntries(BroadphaseData *data, int capacity)
+{
+    data->entries = (BroadphaseEntry *)RL_REALLOC(data->entries, capacity*sizeof(BroadphaseEntry));
+
+    for (int i = capacity - 1; i >= data->entryCapacity; i--)
+    {
+        data->entries[i].next = data->freeEntry;
+        data->freeEntry = i;
+    }
+
+    data->entryCapacity = capacity;
+}
+
+// Get broadphase hash bucket for grid cell
+static int GetBroadphaseBucket(const BroadphaseData *data, int cellX, int cellY)
+{
+    unsigned int hash = ((unsigned int)cellX*73856093u) ^ ((unsigned int)cellY*19349663u);
+
+    return (int)(hash & (unsigned int)(data->bucketCount - 1));
+}
+
+// Set broadphase proxy grid cells range from proxy bounds
+static void SetBroadphaseProxyCells(BroadphaseData *data, float cellSize, int id)
+{
+    BroadphaseProxy *proxy = &data->proxies[id];
+
+    proxy->cellMinX = (int)floorf(proxy->bounds.x/cellSize);
+    proxy->cellMinY = (int)floorf(proxy->bounds.y/cellSize);
+    proxy->cellMaxX = (int)floorf((proxy->bounds.x + proxy->bounds.width)/cellSize);
+    proxy->cellMaxY = (int)floorf((proxy->bounds.y + proxy->bounds.height)/cellSize);
+}
+
+// Insert broadphase proxy in all grid cells covered by its cells range
+static void InsertBroadphaseCells(BroadphaseData *data, int id)
+{
+    const BroadphaseProxy *proxy = &data->proxies[id];
+
+    for (int y = proxy->cellMinY; y <= proxy->cellMaxY; y++)
+    {
+        for (int x = proxy->cellMinX; x <= proxy->cellMaxX; x++)
+        {
+            if (data->freeEntry == -1) GrowBroadphaseEntries(data, 2*data->entryCapacity);
+
+            int e = data->freeEntry;
+            int bucket = GetBroadphaseBucket(data, x, y);
+            data->freeEntry = data->entries[e].next;
+
+            data->entries[e].proxy = id;
+            data->entries[e].cellX = x;
+            data->entries[e].cellY = y;
+            data->entries[e].next = data->buckets[bucket];
+            data->buckets[bucket] = e;
+        }
+    }
+}
+
+// Remove broadphase proxy from all grid cells covered by its cells range
+static void RemoveBroadphaseCells(BroadphaseData *data, int id)
+{
+    const BroadphaseProxy *proxy = &data->proxies[id];
+
+    for (int y = proxy->cellMinY; y <= proxy->cellMaxY; y++)
+    {
+        for (int x = proxy->cellMinX; x <= proxy->cellMaxX; x++)
+        {
+            int *link = &data->buckets[GetBroadphaseBucket(data, x, y)];
+
+            while (*link != -1)
+            {
+                BroadphaseEntry *entry = &data->entries[*link];
+
+                if ((entry->proxy == id) && (entry->cellX == x) && (entry->cellY == y))
+                {
+                    int e = *link;
+                    *link = entry->next;
+                    entry->next = data->freeEntry;
+                    data->freeEntry = e;
+                    break;
+                }
+
+                link = &entry->next;
+            }
+        }
+    }
+}
+
+// Sort broadphase proxies by bounds min X for sweep-and-prune
+// NOTE: Insertion sort is almost linear for coherent motion between frames,
+// falling back to qsort() when too many proxies moved (i.e. many proxies added)
+static void SortBroadphaseProxies(BroadphaseData *data)
+{
+    int *sorted = data->sorted;
+    int shifts = 0;
+    int maxShifts = 8*data->sortedCount + 64;
+
+    for (int i = 1; i < data->sortedCount; i++)
+    {
+        int id = sorted[i];
+        float x = data->proxies[id].bounds.x;
+        int j = i - 1;
+
+        while ((j >= 0) && (data->proxies[sorted[j]].bounds.x > x))
+        {
+            sorted[j + 1] = sorted[j];
+            j--;
+            shifts++;
+        }
+
+        sorted[j + 1] = id;
+
+        if (shifts > maxShifts)
+        {
+            BroadphaseSortKey *keys = (BroadphaseSortKey *)RL_MALLOC(data->sortedCount*sizeof(BroadphaseSortKey));
+
+            for (int k = 0; k < data->sortedCount; k++) keys[k] = (BroadphaseSortKey){ data->proxies[sorted[k]].bounds.x, sorted[k] };
+            qsort(keys, data->sortedCount, sizeof(BroadphaseSortKey), CompareBroadphaseSortKeys);
+            for (int k = 0; k < data->sortedCount; k++) sorted[k] = keys[k].id;
+
+            RL_FREE(keys);
+            break;
+        }
+    }
+}
+
+// Compare broadphase sort keys, used by qsort()
+static int CompareBroadphaseSortKeys(const void *a, const void *b)
+{
+    float x1 = ((const BroadphaseSortKey *)a)->x;
+    float x2 = ((const BroadphaseSortKey *)b)->x;
+
+    return (x1 > x2) - (x1 < x2);
+}
+
+#if defined(SHAPES_SIMD_SSE) || defined(SHAPES_SIMD_NEON)
+// Store indices of colliding elements from a 4 lanes mask, returns updated count
+static int StoreCollisionIndices(int mask, int first, int *indices, int count)
+{
+    for (int lane = 0; lane < 4; lane++)
+    {
+        if (mask & (1 << lane))
+        {
+            if (indices != NULL) indices[count] = first + lane;
+            count++;
+        }
+    }
+
+    return count;
+}
+#endif
+
+#if defined(SHAPES_SIMD_NEON)
+// Get 4 lanes mask from NEON comparison result, one bit per lane
+static int GetCollisionMaskNeon(uint32x4_t result)
+{
+    uint32_t lanes[4] = { 0 };
+    vst1q_u32(lanes, result);
+
+    return (int)((lanes[0] & 1) | (lanes[1] & 2) | (lanes[2] & 4) | (lanes[3] & 8));
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RSHAPES
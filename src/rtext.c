@@ -13,6 +13,7 @@
 *       #define SUPPORT_FILEFORMAT_FNT
 *       #define SUPPORT_FILEFORMAT_TTF
 *       #define SUPPORT_FILEFORMAT_BDF
+*       #define SUPPORT_FILEFORMAT_RFNT
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
 *
@@ -27,6 +28,14 @@
 *       #define MAX_TEXTSPLIT_COUNT
 *           TextSplit() function static substrings pointers array (pointing to static buffer)
 *
+*       #define SUPPORT_FONT_KERNING
+*           Load TTF font kerning pairs for loaded glyphs [LoadFontEx()], kerning is applied by
+*           DrawTextEx(), MeasureTextEx() and text layouts using a glyphs pairs hash table
+*
+*       #define SUPPORT_FONT_PARALLEL_LOADING
+*           Rasterize TTF font glyphs on multiple threads [LoadFontData()], every glyph is
+*           rasterized independently, so result is the same as rasterizing them on a single thread
+*
 *   DEPENDENCIES:
 *       stb_truetype  - Load TTF file and rasterize characters data
 *       stb_rect_pack - Rectangles packing algorithms, required for font atlas generation
@@ -63,7 +72,7 @@
 #if defined(SUPPORT_MODULE_RTEXT)
 
 #include "utils.h"          // Required for: LoadFile*()
-#include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
+#include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro() and dynamic fonts
 
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stdio.h>          // Required for: vsprintf()
@@ -102,6 +111,25 @@
     #endif
 #endif
 
+// Platform specific threading required for parallel glyphs rasterization
+// NOTE: If threading is not available, glyphs are rasterized on calling thread
+#if defined(SUPPORT_FILEFORMAT_TTF) && defined(SUPPORT_FONT_PARALLEL_LOADING)
+    #if defined(_WIN32)
+        // NOTE: We declare required threading functions symbols to avoid including windows.h (kernel32.lib linkage required)
+        __declspec(dllimport) void *__stdcall CreateThread(void *lpThreadAttributes, size_t dwStackSize, unsigned long (__stdcall *lpStartAddress)(void *), void *lpParameter, unsigned long dwCreationFlags, unsigned long *lpThreadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short GroupNumber);
+
+        #define FONT_THREAD_WIN32
+    #elif !defined(PLATFORM_WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+        #include <pthread.h>        // Required for: pthread_create(), pthread_join()
+        #include <unistd.h>         // Required for: sysconf()
+
+        #define FONT_THREAD_PTHREAD
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -115,11 +143,141 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef MAX_DYNAMIC_FONTS
+    #define MAX_DYNAMIC_FONTS                      8        // Maximum number of dynamic fonts loaded: LoadFontDynamic()
+#endif
+#ifndef MAX_DYNAMIC_FONT_PAGES
+    #define MAX_DYNAMIC_FONT_PAGES                 4        // Maximum number of atlas pages per dynamic font
+#endif
+#ifndef DYNAMIC_FONT_PAGE_SIZE
+    #define DYNAMIC_FONT_PAGE_SIZE              1024        // Dynamic font atlas page size in pixels (width and height)
+#endif
+
+#ifndef MAX_FONT_LOADING_THREADS
+    #define MAX_FONT_LOADING_THREADS              16        // Maximum number of threads to rasterize glyphs: LoadFontData()
+#endif
+
+#define DYNAMIC_FONT_HASH_SIZE                  1024        // Dynamic font glyphs hash buckets (power of two)
+#define FONT_LOADING_THREAD_MIN_GLYPHS            32        // Minimum number of glyphs rasterized per thread
+#define FONT_KERNING_GPOS_MAX_GLYPHS             512        // Maximum number of glyphs to query all GPOS kerning pairs
+
+#define RFNT_FILE_ID                      0x544e4672        // Binary font file identifier: "rFNT"
+#define RFNT_FILE_VERSION                          1        // Binary font file format version
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+// Binary font file header (.rfnt), followed by glyphs, kerning table and atlas pixel data
+// NOTE: Values are stored in platform byte order, files are not portable between little-endian and big-endian platforms
+typedef struct FontFileHeader {
+    unsigned int id;            // File identifier: RFNT_FILE_ID
+    unsigned short version;     // File format version
+    unsigned short reserved;    // Reserved for future use
+    int baseSize;               // Font base size
+    int glyphCount;             // Number of glyphs
+    int glyphPadding;           // Padding around glyphs on atlas
+    int kerningTableSize;       // Kerning pairs hash table size (0 for no kerning)
+    int atlasWidth;             // Atlas width
+    int atlasHeight;            // Atlas height
+    int atlasFormat;            // Atlas pixel format (PixelFormat), compressed formats supported
+    int atlasMipmaps;           // Atlas mipmap levels
+    int atlasDataSize;          // Atlas pixel data size in bytes (all mipmap levels)
+} FontFileHeader;
+
+// Binary font file glyph
+typedef struct FontFileGlyph {
+    int value;                  // Glyph codepoint
+    int offsetX;                // Glyph offset X when drawing
+    int offsetY;                // Glyph offset Y when drawing
+    int advanceX;               // Glyph advance position X
+    float x;                    // Glyph rectangle on atlas: x
+    float y;                    // Glyph rectangle on atlas: y
+    float width;                // Glyph rectangle on atlas: width
+    float height;               // Glyph rectangle on atlas: height
+} FontFileGlyph;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
+// Font atlas rectangle to pack, padding included
+typedef struct FontAtlasRec {
+    int x;                      // Rectangle position X on atlas
+    int y;                      // Rectangle position Y on atlas
+    int width;                  // Rectangle width
+    int height;                 // Rectangle height
+    int id;                     // Glyph index
+} FontAtlasRec;
+
+// Font atlas skyline node, top edge of packed area
+typedef struct FontAtlasNode {
+    int x;                      // Node position X
+    int y;                      // Node position Y (top of packed area)
+    int width;                  // Node width
+} FontAtlasNode;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font glyphs rasterization job, glyphs are interleaved between jobs: first, first + stride...
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo; // TTF font info (only read)
+    GlyphInfo *glyphs;          // Glyphs to fill, every job fills different glyphs
+    const int *codepoints;      // Glyphs codepoints
+    int codepointCount;         // Glyphs codepoints count
+    int first;                  // First glyph rasterized by job
+    int stride;                 // Glyphs stride (number of jobs)
+    int fontSize;               // Font size
+    float scaleFactor;          // Font scale factor
+    int ascent;                 // Font ascent (unscaled)
+    int type;                   // Font type: FONT_DEFAULT, FONT_BITMAP, FONT_SDF
+} FontGlyphsJob;
+
+// Dynamic font glyph, rasterized on first use into an atlas page
+typedef struct DynamicGlyph {
+    int codepoint;              // Glyph codepoint (unicode)
+    int shelf;                  // Atlas shelf containing glyph image (-1 for glyphs without image)
+    Rectangle rec;              // Glyph rectangle on atlas page (padding not included)
+    int offsetX;                // Glyph offset X when drawing
+    int offsetY;                // Glyph offset Y when drawing
+    int advanceX;               // Glyph advance position X
+    int next;                   // Next glyph on hash bucket or free list (-1 for none)
+} DynamicGlyph;
+
+// Dynamic font atlas shelf, atlas page row filled left to right with glyphs of similar height
+typedef struct DynamicFontShelf {
+    int page;                   // Atlas page
+    int y;                      // Shelf position Y on atlas page
+    int height;                 // Shelf height
+    int width;                  // Shelf width filled with glyphs
+    unsigned int lastUse;       // Shelf last use stamp, least recently used shelf is evicted first
+    bool pinned;                // Shelf with preloaded glyphs, never evicted
+} DynamicFontShelf;
+
+// Dynamic font, TTF data kept to rasterize glyphs on demand
+typedef struct DynamicFont {
+    unsigned int id;            // Font id: first atlas page texture id (0 for unused)
+    unsigned char *fileData;    // TTF font file data (copy)
+    stbtt_fontinfo info;        // TTF font info
+    float scale;                // Font scale factor for base size
+    int ascent;                 // Font ascent (scaled)
+    int baseSize;               // Font base size (glyphs height)
+    int padding;                // Padding around glyphs on atlas
+
+    Texture2D pages[MAX_DYNAMIC_FONT_PAGES];    // Atlas pages textures
+    int pageHeights[MAX_DYNAMIC_FONT_PAGES];    // Atlas pages height filled with shelves
+    int pageCount;              // Atlas pages count
+
+    DynamicFontShelf *shelves;  // Atlas shelves
+    int shelfCount;             // Atlas shelves count
+    int shelfCapacity;          // Atlas shelves allocated
+
+    DynamicGlyph *glyphs;       // Glyphs cached
+    int glyphCount;             // Glyphs used (cached or free)
+    int glyphCapacity;          // Glyphs allocated
+    int freeGlyph;              // Glyphs free list first glyph (-1 for none)
+    int buckets[DYNAMIC_FONT_HASH_SIZE];        // Glyphs hash buckets by codepoint, first glyph (-1 for none)
+    unsigned int useStamp;      // Current use stamp, increased on every glyph use
+} DynamicFont;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -130,6 +288,11 @@
 static Font defaultFont = { 0 };
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static DynamicFont dynamicFonts[MAX_DYNAMIC_FONTS] = { 0 };    // Dynamic fonts data, glyphs rasterized on demand
+static int fontLoadingThreads = 0;              // Maximum number of threads to rasterize glyphs (0 for all processor cores)
+#endif
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -141,9 +304,43 @@ static Font defaultFont = { 0 };
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode font file)
 #endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+static Font LoadFontRFNT(const unsigned char *fileData, int dataSize);  // Load font from binary font file data (.rfnt)
+#endif
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+static int GetFontDataSize(Font font);          // Get font glyphs data size in bytes (CPU memory)
+#endif
+#if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
+static int PackFontAtlasRecs(FontAtlasRec *recs, int count, int atlasWidth, FontAtlasNode *nodes); // Pack font atlas rectangles (skyline)
+static int CompareFontAtlasRecs(const void *a, const void *b);  // Compare font atlas rectangles by height
+#endif
+static void GenTextLayout(TextLayout *layout);  // Generate text layout glyphs quads
+static unsigned int GetKerningHash(int first, int second);      // Get kerning pairs hash table hash for glyphs pair
+static float GetKerningAdvance(Font font, int first, int second);   // Get kerning advance adjustment between two glyphs
+static GlyphKerning *GenKerningTable(const GlyphKerning *pairs, int pairCount, int *tableSize);  // Generate kerning pairs hash table
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static DynamicFont *GetDynamicFont(Font font);  // Get dynamic font data for a font, NULL if not dynamic
+static void UnloadDynamicFont(DynamicFont *dynamicFont);    // Unload dynamic font data
+static bool AddDynamicFontPage(DynamicFont *dynamicFont);   // Add dynamic font atlas page
+static int AddDynamicFontShelf(DynamicFont *dynamicFont, int page, int height, bool pinned);    // Add dynamic font atlas shelf on page
+static int GetDynamicFontShelf(DynamicFont *dynamicFont, int width, int height, bool pinned);   // Get dynamic font atlas shelf with space for a glyph
+static void EvictDynamicFontShelf(DynamicFont *dynamicFont, int shelf);     // Evict all glyphs on dynamic font atlas shelf
+static int GetDynamicGlyph(DynamicFont *dynamicFont, int codepoint, bool pinned, Image *image);  // Get dynamic font glyph, rasterized on first use
+static float DrawTextCodepointDynamic(DynamicFont *dynamicFont, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character using dynamic font
+static void LoadFontGlyphs(FontGlyphsJob *job); // Rasterize font glyphs job
+static void LoadFontGlyph(const FontGlyphsJob *job, int index); // Rasterize font glyph
+#if defined(SUPPORT_FONT_KERNING)
+static GlyphKerning *LoadFontKerning(const unsigned char *fileData, int fontSize, const GlyphInfo *glyphs, int glyphCount, int *tableSize); // Load font kerning pairs hash table
+#endif
+#endif
+#if defined(FONT_THREAD_WIN32)
+static unsigned long __stdcall LoadFontGlyphsThread(void *arg);  // Font glyphs rasterization thread
+#elif defined(FONT_THREAD_PTHREAD)
+static void *LoadFontGlyphsThread(void *arg);   // Font glyphs rasterization thread
+#endif
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -352,6 +549,19 @@ Font LoadFont(const char *fileName)
     if (IsFileExtension(fileName, ".fnt")) font = LoadBMFont(fileName);
     else
 #endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (IsFileExtension(fileName, ".rfnt"))
+    {
+        // NOTE: Single file read, atlas texture is uploaded directly from file data
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+        font = LoadFontFromMemory(".rfnt", fileData, dataSize, 0, NULL, 0);
+
+        UnloadFileData(fileData);
+    }
+    else
+#endif
 #if defined(SUPPORT_FILEFORMAT_BDF)
     if (IsFileExtension(fileName, ".bdf")) font = LoadFontEx(fileName, FONT_TTF_DEFAULT_SIZE, NULL, FONT_TTF_DEFAULT_NUMCHARS);
     else
@@ -516,6 +726,8 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
 
     font.baseSize = (int)font.recs[0].height;
 
+    REGISTER_RESOURCE(RESOURCE_FONT, font.texture.id, font.texture.id, 0, 0, GetFontDataSize(font), "LoadFontFromImage");
+
     return font;
 }
 
@@ -527,6 +739,24 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     char fileExtLower[16] = { 0 };
     strncpy(fileExtLower, TextToLower(fileType), 16 - 1);
 
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    // Binary font file contains font base size and glyphs, fontSize and codepoints are not used
+    if (TextIsEqual(fileExtLower, ".rfnt"))
+    {
+        font = LoadFontRFNT(fileData, dataSize);
+
+        if (font.texture.id != 0)
+        {
+            REGISTER_RESOURCE(RESOURCE_FONT, font.texture.id, font.texture.id, 0, 0, GetFontDataSize(font), "LoadFontFromMemory");
+
+            TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
+        }
+        else font = GetFontDefault();
+
+        return font;
+    }
+#endif
+
     font.baseSize = fontSize;
     font.glyphCount = (codepointCount > 0)? codepointCount : 95;
     font.glyphPadding = 0;
@@ -536,6 +766,9 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
         TextIsEqual(fileExtLower, ".otf"))
     {
         font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, codepoints, font.glyphCount, FONT_DEFAULT);
+    #if defined(SUPPORT_FONT_KERNING)
+        font.kerningTable = LoadFontKerning(fileData, font.baseSize, font.glyphs, font.glyphCount, &font.kerningTableSize);
+    #endif
     }
     else
 #endif
@@ -555,7 +788,7 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     {
         font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
 
-        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
+        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 2);
         font.texture = LoadTextureFromImage(atlas);
 
         // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
@@ -567,6 +800,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
         UnloadImage(atlas);
 
+        REGISTER_RESOURCE(RESOURCE_FONT, font.texture.id, font.texture.id, 0, 0, GetFontDataSize(font), "LoadFontFromMemory");
+
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
     else font = GetFontDefault();
@@ -577,6 +812,129 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load dynamic font from TTF/OTF file, glyphs rasterized on demand
+// NOTE: Default charset (ASCII 32..126) is preloaded, any other glyph is rasterized on first use
+// by DrawTextEx()/MeasureTextEx() into dynamic atlas pages, least recently used glyphs are evicted when full
+Font LoadFontDynamic(const char *fileName, int fontSize)
+{
+    Font font = { 0 };
+
+    // Loading file to memory
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        // Loading font from memory data
+        font = LoadFontDynamicFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize);
+
+        UnloadFileData(fileData);
+    }
+
+    return font;
+}
+
+// Load dynamic font from memory buffer, fileType refers to extension: i.e. ".ttf"
+// NOTE: Font data is copied, required to rasterize glyphs on demand
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    char fileExtLower[16] = { 0 };
+    strncpy(fileExtLower, TextToLower(fileType), 16 - 1);
+
+    if (!TextIsEqual(fileExtLower, ".ttf") && !TextIsEqual(fileExtLower, ".otf"))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Dynamic font requires TTF/OTF font data");
+        return GetFontDefault();
+    }
+
+    DynamicFont *dynamicFont = NULL;
+
+    for (int i = 0; i < MAX_DYNAMIC_FONTS; i++)
+    {
+        if (dynamicFonts[i].id == 0)
+        {
+            dynamicFont = &dynamicFonts[i];
+            break;
+        }
+    }
+
+    if (dynamicFont == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Maximum number of dynamic fonts reached (%i)", MAX_DYNAMIC_FONTS);
+        return GetFontDefault();
+    }
+
+    memset(dynamicFont->buckets, 0xff, DYNAMIC_FONT_HASH_SIZE*sizeof(int));     // Empty buckets: -1
+    dynamicFont->freeGlyph = -1;
+
+    dynamicFont->fileData = (unsigned char *)RL_MALLOC(dataSize);
+    memcpy(dynamicFont->fileData, fileData, dataSize);
+
+    if (!stbtt_InitFont(&dynamicFont->info, dynamicFont->fileData, 0) || !AddDynamicFontPage(dynamicFont))
+    {
+        UnloadDynamicFont(dynamicFont);
+        TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
+        return GetFontDefault();
+    }
+
+    int ascent = 0, descent = 0, lineGap = 0;
+    stbtt_GetFontVMetrics(&dynamicFont->info, &ascent, &descent, &lineGap);
+
+    dynamicFont->id = dynamicFont->pages[0].id;
+    dynamicFont->baseSize = fontSize;
+    dynamicFont->padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+    dynamicFont->scale = stbtt_ScaleForPixelHeight(&dynamicFont->info, (float)fontSize);
+    dynamicFont->ascent = (int)((float)ascent*dynamicFont->scale);
+
+    // First atlas page is used as font texture, preloaded glyphs are also available
+    // as regular font glyphs: GetGlyphIndex(), GetGlyphAtlasRec(), ImageTextEx()...
+    font.baseSize = fontSize;
+    font.glyphCount = 95;
+    font.glyphPadding = dynamicFont->padding;
+    font.texture = dynamicFont->pages[0];
+    font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_CALLOC(font.glyphCount, sizeof(Rectangle));
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        int index = GetDynamicGlyph(dynamicFont, i + 32, true, &font.glyphs[i].image);
+
+        font.glyphs[i].value = i + 32;
+
+        if (index != -1)
+        {
+            font.glyphs[i].offsetX = dynamicFont->glyphs[index].offsetX;
+            font.glyphs[i].offsetY = dynamicFont->glyphs[index].offsetY;
+            font.glyphs[i].advanceX = dynamicFont->glyphs[index].advanceX;
+            font.recs[i] = dynamicFont->glyphs[index].rec;
+        }
+    }
+
+    REGISTER_RESOURCE(RESOURCE_FONT, font.texture.id, font.texture.id, 0, 0, GetFontDataSize(font), "LoadFontDynamic");
+
+    TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | glyphs rasterized on demand)", font.baseSize);
+#else
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Check if a font is dynamic (glyphs rasterized on demand)
+bool IsFontDynamic(Font font)
+{
+    bool result = false;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    result = (GetDynamicFont(font) != NULL);
+#endif
+
+    return result;
+}
+
 // Check if a font is ready
 bool IsFontReady(Font font)
 {
@@ -643,80 +1001,62 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             chars = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < codepointCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+            // Glyphs are interleaved between jobs, one job per thread
+            // NOTE: Every glyph is rasterized independently, font info is only read
+            FontGlyphsJob jobs[MAX_FONT_LOADING_THREADS] = { 0 };
+            int jobCount = 1;
 
-                // Check if a glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, ch);
+        #if defined(FONT_THREAD_WIN32) || defined(FONT_THREAD_PTHREAD)
+            int processorCount = 1;
 
-                if (index > 0)
-                {
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP: chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        case FONT_SDF: if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        default: break;
-                    }
+            #if defined(FONT_THREAD_WIN32)
+                processorCount = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+            #else
+                processorCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+            #endif
 
-                    if (chars[i].image.data != NULL)    // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
+            jobCount = (fontLoadingThreads > 0)? fontLoadingThreads : processorCount;
+            if (jobCount > MAX_FONT_LOADING_THREADS) jobCount = MAX_FONT_LOADING_THREADS;
+            if (jobCount > codepointCount/FONT_LOADING_THREAD_MIN_GLYPHS) jobCount = codepointCount/FONT_LOADING_THREAD_MIN_GLYPHS;
+            if (jobCount < 1) jobCount = 1;
+        #endif
 
-                        // Load characters images
-                        chars[i].image.width = chw;
-                        chars[i].image.height = chh;
-                        chars[i].image.mipmaps = 1;
-                        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+            for (int i = 0; i < jobCount; i++)
+            {
+                jobs[i] = (FontGlyphsJob){ &fontInfo, chars, codepoints, codepointCount, i, jobCount, fontSize, scaleFactor, ascent, type };
+            }
 
-                        chars[i].offsetY += (int)((float)ascent*scaleFactor);
-                    }
+        #if defined(FONT_THREAD_WIN32) || defined(FONT_THREAD_PTHREAD)
+            // First job is processed on calling thread, jobs without thread are processed after it
+            #if defined(FONT_THREAD_WIN32)
+                void *threads[MAX_FONT_LOADING_THREADS] = { 0 };
+                for (int i = 1; i < jobCount; i++) threads[i] = CreateThread(NULL, 0, LoadFontGlyphsThread, &jobs[i], 0, NULL);
+            #else
+                pthread_t threads[MAX_FONT_LOADING_THREADS];
+                bool threadActive[MAX_FONT_LOADING_THREADS] = { 0 };
+                for (int i = 1; i < jobCount; i++) threadActive[i] = (pthread_create(&threads[i], NULL, LoadFontGlyphsThread, &jobs[i]) == 0);
+            #endif
 
-                    // NOTE: We create an empty image for space character,
-                    // it could be further required for atlas packing
-                    if (ch == 32)
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        Image imSpace = {
-                            .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                            .width = chars[i].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        chars[i].image = imSpace;
-                    }
+            LoadFontGlyphs(&jobs[0]);
 
-                    if (type == FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < chw*chh; p++)
-                        {
-                            if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                            else ((unsigned char *)chars[i].image.data)[p] = 255;
-                        }
-                    }
-                }
-                else
+            for (int i = 1; i < jobCount; i++)
+            {
+            #if defined(FONT_THREAD_WIN32)
+                if (threads[i] != NULL)
                 {
-                    // TODO: Use some fallback glyph for codepoints not found in the font
+                    WaitForSingleObject(threads[i], 0xFFFFFFFF);    // INFINITE
+                    CloseHandle(threads[i]);
                 }
+            #else
+                if (threadActive[i]) pthread_join(threads[i], NULL);
+            #endif
+                else LoadFontGlyphs(&jobs[i]);
             }
+
+            if (jobCount > 1) TRACELOGD("FONT: Font glyphs rasterized on %i threads (%i glyphs)", jobCount, codepointCount);
+        #else
+            LoadFontGlyphs(&jobs[0]);
+        #endif
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -728,7 +1068,7 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 }
 
 // Generate image font atlas using chars info
-// NOTE: Packing method: 0-Default, 1-Skyline
+// NOTE: Packing method: 0-Default, 1-Skyline, 2-Skyline sorted by height (tight atlas size, NPOT if supported)
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
 Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod)
 {
@@ -791,6 +1131,70 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     }
 #endif
 
+    FontAtlasRec *packRecs = NULL;
+
+    if (packMethod == 2)
+    {
+        // Glyphs sorted by height, packed for multiple atlas widths, smallest atlas is kept
+        // NOTE: NPOT atlas size only if fully supported, it could be also used before rlgl initialization
+        bool sizeNPOT = rlIsTextureNPOTSupported();
+        int totalArea = 0;
+        int maxRecWidth = 0;
+
+        packRecs = (FontAtlasRec *)RL_MALLOC(glyphCount*sizeof(FontAtlasRec));
+        FontAtlasNode *nodes = (FontAtlasNode *)RL_MALLOC((glyphCount + 1)*sizeof(FontAtlasNode));
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            packRecs[i] = (FontAtlasRec){ 0, 0, glyphs[i].image.width + 2*padding, glyphs[i].image.height + 2*padding, i };
+            totalArea += packRecs[i].width*packRecs[i].height;
+            if (packRecs[i].width > maxRecWidth) maxRecWidth = packRecs[i].width;
+        }
+
+        qsort(packRecs, glyphCount, sizeof(FontAtlasRec), CompareFontAtlasRecs);
+
+        int minSize = (int)ceilf(sqrtf((float)totalArea));
+        int potSize = 4;
+        while (potSize < minSize) potSize *= 2;
+
+        int bestWidth = 0;
+        int bestHeight = 0;
+
+        for (int i = 0; i < 3; i++)
+        {
+            int width = 0;
+
+            if (sizeNPOT)
+            {
+                width = (int)(minSize*(1.0f + 0.1f*i));     // Square atlas or slightly wider
+                if (width < maxRecWidth) width = maxRecWidth;
+                width = (width + 3) & ~3;                   // Keep rows 4-bytes aligned
+            }
+            else
+            {
+                width = (potSize/2) << i;                   // Half, same or double POT size
+                while (width < maxRecWidth) width *= 2;
+            }
+
+            // NOTE: Bottom 3 pixels rows are kept free for white rectangle
+            int height = PackFontAtlasRecs(packRecs, glyphCount, width, nodes) + 3;
+
+            if (!sizeNPOT) height = 1 << (int)ceilf(log2f((float)height));
+
+            if ((bestWidth == 0) || (((long long)width*height) < ((long long)bestWidth*bestHeight)))
+            {
+                bestWidth = width;
+                bestHeight = height;
+            }
+        }
+
+        PackFontAtlasRecs(packRecs, glyphCount, bestWidth, nodes);
+        RL_FREE(nodes);
+
+        atlas.width = bestWidth;
+        atlas.height = bestHeight;
+    }
+
     atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp)
     atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
     atlas.mipmaps = 1;
@@ -895,6 +1299,33 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
         RL_FREE(nodes);
         RL_FREE(context);
     }
+    else if (packMethod == 2)  // Use skyline rect packing sorted by height
+    {
+        for (int k = 0; k < glyphCount; k++)
+        {
+            int i = packRecs[k].id;
+            int offsetX = packRecs[k].x + padding;
+            int offsetY = packRecs[k].y + padding;
+
+            for (int y = 0; y < glyphs[i].image.height; y++)
+            {
+                memcpy((unsigned char *)atlas.data + (offsetY + y)*atlas.width + offsetX, (unsigned char *)glyphs[i].image.data + y*glyphs[i].image.width, glyphs[i].image.width);
+            }
+
+            recs[i].x = (float)offsetX;
+            recs[i].y = (float)offsetY;
+            recs[i].width = (float)glyphs[i].image.width;
+            recs[i].height = (float)glyphs[i].image.height;
+        }
+
+        RL_FREE(packRecs);
+    }
+
+    // Packing efficiency: glyphs area (padding included) vs atlas area
+    int glyphsArea = 0;
+    for (int i = 0; i < glyphCount; i++) glyphsArea += (glyphs[i].image.width + 2*padding)*(glyphs[i].image.height + 2*padding);
+
+    TRACELOG(LOG_INFO, "FONT: Atlas generated successfully (%ix%i | %i glyphs | %.1f%% packing efficiency)", atlas.width, atlas.height, glyphCount, 100.0f*glyphsArea/(atlas.width*atlas.height));
 
 #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
     // Add a 3x3 white rectangle at the bottom-right corner of the generated atlas,
@@ -945,14 +1376,97 @@ void UnloadFont(Font font)
     // NOTE: Make sure font is not default font (fallback)
     if (font.texture.id != GetFontDefault().texture.id)
     {
+        UNREGISTER_RESOURCE(RESOURCE_FONT, font.texture.id);
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        DynamicFont *dynamicFont = GetDynamicFont(font);
+        if (dynamicFont != NULL) UnloadDynamicFont(dynamicFont);
+#endif
         UnloadFontData(font.glyphs, font.glyphCount);
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        RL_FREE(font.kerningTable);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
 }
 
+// Export font as binary file (.rfnt), returns true on success
+// NOTE: Atlas is exported in font texture pixel format, font can be loaded with LoadFont()
+bool ExportFont(Font font, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (!IsFileExtension(fileName, ".rfnt"))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Font export file format not supported", fileName);
+        return false;
+    }
+
+    if ((font.texture.id == 0) || (font.glyphs == NULL) || (font.recs == NULL) || IsFontDynamic(font))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Font not valid for export", fileName);
+        return false;
+    }
+
+    Image atlas = LoadImageFromTexture(font.texture);
+
+    if (atlas.data != NULL)
+    {
+        FontFileHeader header = { 0 };
+        header.id = RFNT_FILE_ID;
+        header.version = RFNT_FILE_VERSION;
+        header.baseSize = font.baseSize;
+        header.glyphCount = font.glyphCount;
+        header.glyphPadding = font.glyphPadding;
+        header.kerningTableSize = (font.kerningTable != NULL)? font.kerningTableSize : 0;
+        header.atlasWidth = atlas.width;
+        header.atlasHeight = atlas.height;
+        header.atlasFormat = atlas.format;
+        header.atlasMipmaps = 1;
+        header.atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+
+        int dataSize = sizeof(FontFileHeader) + header.glyphCount*sizeof(FontFileGlyph) + header.kerningTableSize*sizeof(GlyphKerning) + header.atlasDataSize;
+        unsigned char *fileData = (unsigned char *)RL_MALLOC(dataSize);
+        unsigned char *fileDataPtr = fileData;
+
+        memcpy(fileDataPtr, &header, sizeof(FontFileHeader));
+        fileDataPtr += sizeof(FontFileHeader);
+
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            FontFileGlyph glyph = {
+                font.glyphs[i].value, font.glyphs[i].offsetX, font.glyphs[i].offsetY, font.glyphs[i].advanceX,
+                font.recs[i].x, font.recs[i].y, font.recs[i].width, font.recs[i].height
+            };
+
+            memcpy(fileDataPtr, &glyph, sizeof(FontFileGlyph));
+            fileDataPtr += sizeof(FontFileGlyph);
+        }
+
+        if (header.kerningTableSize > 0)
+        {
+            memcpy(fileDataPtr, font.kerningTable, header.kerningTableSize*sizeof(GlyphKerning));
+            fileDataPtr += header.kerningTableSize*sizeof(GlyphKerning);
+        }
+
+        memcpy(fileDataPtr, atlas.data, header.atlasDataSize);
+
+        success = SaveFileData(fileName, fileData, dataSize);
+
+        RL_FREE(fileData);
+        UnloadImage(atlas);
+    }
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Font exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export font", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Font binary export not supported", fileName);
+#endif
+
+    return success;
+}
+
 // Export font as code file, returns true on success
 bool ExportFontAsCode(Font font, const char *fileName)
 {
@@ -1120,6 +1634,27 @@ void DrawFPS(int posX, int posY)
     DrawText(TextFormat("%2i FPS", fps), posX, posY, 20, color);
 }
 
+// Draw render statistics of last frame (draw calls, batches, vertices, binds, uploads and GPU time)
+// NOTE: GPU time is only available if RLGL_ENABLE_GPU_TIMERS is defined and supported by the platform
+void DrawFrameStats(int posX, int posY)
+{
+    rlFrameStats stats = rlGetFrameStats();
+    int fontSize = 10;
+    int spacing = fontSize + 2;
+
+    DrawText(TextFormat("DRAW CALLS: %i (BATCHES: %i)", stats.drawCalls, stats.batchFlushes), posX, posY, fontSize, LIME);
+    DrawText(TextFormat("VERTICES: %i", stats.vertexCount), posX, posY + spacing, fontSize, LIME);
+    DrawText(TextFormat("TEXTURES: %i BINDS, %i SWITCHES", stats.textureBinds, stats.textureSwitches), posX, posY + spacing*2, fontSize, LIME);
+    DrawText(TextFormat("SHADERS: %i", stats.shaderSwitches), posX, posY + spacing*3, fontSize, LIME);
+    DrawText(TextFormat("UPLOADED: %.2f KB", (float)stats.bufferBytes/1024.0f), posX, posY + spacing*4, fontSize, LIME);
+
+    if (stats.gpuTime[RL_GPU_TIMER_FRAME] > 0.0f)
+    {
+        DrawText(TextFormat("GPU: %.2f ms (2D: %.2f, 3D: %.2f, RT: %.2f)", stats.gpuTime[RL_GPU_TIMER_FRAME],
+            stats.gpuTime[RL_GPU_TIMER_MODE_2D], stats.gpuTime[RL_GPU_TIMER_MODE_3D], stats.gpuTime[RL_GPU_TIMER_TEXTURE_MODE]), posX, posY + spacing*5, fontSize, LIME);
+    }
+}
+
 // Draw text (using default font)
 // NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
 // NOTE: chars spacing is proportional to fontSize
@@ -1144,28 +1679,44 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 {
     if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    DynamicFont *dynamicFont = GetDynamicFont(font);   // Dynamic fonts glyphs are rasterized on demand
+#endif
+
     int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
     float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    int previousIndex = -1;         // Previous glyph index on line, required for kerning
 
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
         int codepointByteCount = 0;
         int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
-        int index = GetGlyphIndex(font, codepoint);
 
         if (codepoint == '\n')
         {
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textOffsetY += (fontSize + textLineSpacing);
             textOffsetX = 0.0f;
+            previousIndex = -1;
+        }
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        else if (dynamicFont != NULL)
+        {
+            textOffsetX += (DrawTextCodepointDynamic(dynamicFont, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint) + spacing);
         }
+#endif
         else
         {
+            int index = GetGlyphIndex(font, codepoint);
+
+            textOffsetX += GetKerningAdvance(font, previousIndex, index)*scaleFactor;
+            previousIndex = index;
+
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
                 DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
@@ -1196,6 +1747,16 @@ void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin,
 // Draw one character (codepoint)
 void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint)
 {
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    DynamicFont *dynamicFont = GetDynamicFont(font);
+
+    if (dynamicFont != NULL)
+    {
+        DrawTextCodepointDynamic(dynamicFont, codepoint, position, fontSize, tint);
+        return;
+    }
+#endif
+
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
@@ -1225,18 +1786,33 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    DynamicFont *dynamicFont = GetDynamicFont(font);   // Dynamic fonts glyphs are rasterized on demand
+#endif
+    int previousIndex = -1;         // Previous glyph index on line, required for kerning
+
     for (int i = 0; i < codepointCount; i++)
     {
-        int index = GetGlyphIndex(font, codepoints[i]);
-
         if (codepoints[i] == '\n')
         {
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textOffsetY += (fontSize + textLineSpacing);
             textOffsetX = 0.0f;
+            previousIndex = -1;
+        }
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        else if (dynamicFont != NULL)
+        {
+            textOffsetX += (DrawTextCodepointDynamic(dynamicFont, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint) + spacing);
         }
+#endif
         else
         {
+            int index = GetGlyphIndex(font, codepoints[i]);
+
+            textOffsetX += GetKerningAdvance(font, previousIndex, index)*scaleFactor;
+            previousIndex = index;
+
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
                 DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
@@ -1248,6 +1824,15 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
     }
 }
 
+// Set maximum number of threads used to rasterize font glyphs [LoadFontData()], 0 for all processor cores
+// NOTE: Only used if threading is available, glyphs are rasterized on calling thread otherwise
+void SetFontLoadingThreads(int count)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    fontLoadingThreads = (count > 0)? count : 0;
+#endif
+}
+
 // Set vertical line spacing when drawing with line-breaks
 void SetTextLineSpacing(int spacing)
 {
@@ -1291,6 +1876,11 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 
     int letter = 0;                 // Current character
     int index = 0;                  // Index position in sprite font
+    int previousIndex = -1;         // Previous glyph index on line, required for kerning
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    DynamicFont *dynamicFont = GetDynamicFont(font);   // Dynamic fonts glyphs are rasterized on demand
+#endif
 
     for (int i = 0; i < size;)
     {
@@ -1298,12 +1888,31 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 
         int next = 0;
         letter = GetCodepointNext(&text[i], &next);
-        index = GetGlyphIndex(font, letter);
 
         i += next;
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if ((letter != '\n') && (dynamicFont != NULL))
+        {
+            index = GetDynamicGlyph(dynamicFont, letter, false, NULL);
+
+            if (index != -1)
+            {
+                const DynamicGlyph *glyph = &dynamicFont->glyphs[index];
+
+                if (glyph->advanceX != 0) textWidth += glyph->advanceX;
+                else textWidth += (glyph->rec.width + glyph->offsetX);
+            }
+        }
+        else
+#endif
         if (letter != '\n')
         {
+            index = GetGlyphIndex(font, letter);
+
+            textWidth += GetKerningAdvance(font, previousIndex, index);
+            previousIndex = index;
+
             if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
             else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
         }
@@ -1312,6 +1921,7 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
             if (tempTextWidth < textWidth) tempTextWidth = textWidth;
             byteCounter = 0;
             textWidth = 0;
+            previousIndex = -1;
 
             // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
             textHeight += (fontSize + textLineSpacing);
@@ -1364,11 +1974,40 @@ GlyphInfo GetGlyphInfo(Font font, int codepoint)
 {
     GlyphInfo info = { 0 };
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic fonts glyphs not preloaded provide glyph metrics only (no image)
+    DynamicFont *dynamicFont = GetDynamicFont(font);
+
+    if ((dynamicFont != NULL) && ((codepoint < 32) || (codepoint > 126)))
+    {
+        int index = GetDynamicGlyph(dynamicFont, codepoint, false, NULL);
+
+        if (index != -1)
+        {
+            info.value = dynamicFont->glyphs[index].codepoint;
+            info.offsetX = dynamicFont->glyphs[index].offsetX;
+            info.offsetY = dynamicFont->glyphs[index].offsetY;
+            info.advanceX = dynamicFont->glyphs[index].advanceX;
+        }
+
+        return info;
+    }
+#endif
+
     info = font.glyphs[GetGlyphIndex(font, codepoint)];
 
     return info;
 }
 
+// Get kerning advance adjustment between two codepoints (for font base size)
+// NOTE: Kerning pairs are loaded with font [LoadFontEx()], lookup is constant time
+float GetGlyphKerning(Font font, int codepoint, int nextCodepoint)
+{
+    if (font.kerningTable == NULL) return 0.0f;
+
+    return GetKerningAdvance(font, GetGlyphIndex(font, codepoint), GetGlyphIndex(font, nextCodepoint));
+}
+
 // Get glyph rectangle in font atlas for a codepoint (unicode character)
 // NOTE: If codepoint is not found in the font it fallbacks to '?'
 Rectangle GetGlyphAtlasRec(Font font, int codepoint)
@@ -1380,6 +2019,124 @@ Rectangle GetGlyphAtlasRec(Font font, int codepoint)
     return rec;
 }
 
+//----------------------------------------------------------------------------------
+// Text layout functions
+//----------------------------------------------------------------------------------
+// Load text layout, glyphs quads computed once and cached for drawing
+// NOTE: Lines are wrapped on spaces if wrapWidth > 0, words longer than wrapWidth are split
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing, float wrapWidth)
+{
+    TextLayout layout = { 0 };
+
+    UpdateTextLayout(&layout, font, text, fontSize, spacing, wrapWidth);
+
+    return layout;
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.text);
+    RL_FREE(layout.codepoints);
+    RL_FREE(layout.vertices);
+    RL_FREE(layout.texcoords);
+}
+
+// Update text layout, glyphs quads computed again only if any input changed
+// NOTE: Font is only referenced by layout, it must not be unloaded while layout is in use
+void UpdateTextLayout(TextLayout *layout, Font font, const char *text, float fontSize, float spacing, float wrapWidth)
+{
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+    if (text == NULL) text = "";
+
+    if ((layout->text != NULL) &&
+        (layout->font.texture.id == font.texture.id) &&
+        (layout->font.glyphs == font.glyphs) &&
+        (layout->fontSize == fontSize) &&
+        (layout->spacing == spacing) &&
+        (layout->wrapWidth == wrapWidth) &&
+        (layout->lineSpacing == textLineSpacing) &&
+        (strcmp(layout->text, text) == 0)) return;
+
+    int length = TextLength(text);
+
+    layout->font = font;
+    layout->fontSize = fontSize;
+    layout->spacing = spacing;
+    layout->wrapWidth = wrapWidth;
+    layout->lineSpacing = textLineSpacing;
+    layout->text = (char *)RL_REALLOC(layout->text, length + 1);
+    memcpy(layout->text, text, length + 1);
+
+    // NOTE: Every codepoint requires at least one byte, glyphs count is never bigger than text length
+    int capacity = (length > 0)? length : 1;
+    layout->codepoints = (int *)RL_REALLOC(layout->codepoints, capacity*sizeof(int));
+    layout->vertices = (float *)RL_REALLOC(layout->vertices, 8*capacity*sizeof(float));
+    layout->texcoords = (float *)RL_REALLOC(layout->texcoords, 8*capacity*sizeof(float));
+
+    GenTextLayout(layout);
+}
+
+// Draw text layout, cached glyphs quads submitted with a single transform
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    if (layout.glyphCount == 0) return;
+
+    rlPushMatrix();
+
+        rlTranslatef(position.x, position.y, 0.0f);
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        DynamicFont *dynamicFont = GetDynamicFont(layout.font);
+
+        if (dynamicFont != NULL)
+        {
+            // Dynamic fonts glyphs could be evicted or moved on atlas pages,
+            // texture coordinates are taken from glyphs cache on drawing
+            for (int i = 0; i < layout.glyphCount; i++)
+            {
+                int index = GetDynamicGlyph(dynamicFont, layout.codepoints[i], false, NULL);
+
+                if ((index == -1) || (dynamicFont->glyphs[index].shelf == -1)) continue;
+
+                const DynamicGlyph *glyph = &dynamicFont->glyphs[index];
+                float padding = (float)dynamicFont->padding;
+                float left = (glyph->rec.x - padding)/DYNAMIC_FONT_PAGE_SIZE;
+                float right = (glyph->rec.x + glyph->rec.width + padding)/DYNAMIC_FONT_PAGE_SIZE;
+                float top = (glyph->rec.y - padding)/DYNAMIC_FONT_PAGE_SIZE;
+                float bottom = (glyph->rec.y + glyph->rec.height + padding)/DYNAMIC_FONT_PAGE_SIZE;
+                float texcoords[8] = { left, top, left, bottom, right, bottom, right, top };
+
+                rlSetTexture(dynamicFont->pages[dynamicFont->shelves[glyph->shelf].page].id);
+                rlBegin(RL_QUADS);
+
+                    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                    rlNormal3f(0.0f, 0.0f, 1.0f);              // Normal vector pointing towards viewer
+
+                    rlVertexTexCoord2fv(layout.vertices + 8*i, texcoords, 4);
+
+                rlEnd();
+            }
+        }
+        else
+#endif
+        {
+            rlSetTexture(layout.font.texture.id);
+            rlBegin(RL_QUADS);
+
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                  // Normal vector pointing towards viewer
+
+                rlVertexTexCoord2fv(layout.vertices, layout.texcoords, 4*layout.glyphCount);
+
+            rlEnd();
+        }
+
+        rlSetTexture(0);
+
+    rlPopMatrix();
+}
+
 //----------------------------------------------------------------------------------
 // Text strings management functions
 //----------------------------------------------------------------------------------
@@ -2306,13 +3063,175 @@ static Font LoadBMFont(const char *fileName)
         font = GetFontDefault();
         TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load texture, reverted to default font", fileName);
     }
-    else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+    else
+    {
+        REGISTER_RESOURCE(RESOURCE_FONT, font.texture.id, font.texture.id, 0, 0, GetFontDataSize(font), "LoadFont");
+        TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+    }
 
     return font;
 }
 
 #endif
 
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+// Get font glyphs data size in bytes (CPU memory)
+// NOTE: Font atlas texture is tracked as a texture resource
+static int GetFontDataSize(Font font)
+{
+    int size = font.glyphCount*(sizeof(GlyphInfo) + sizeof(Rectangle));
+
+    for (int i = 0; i < font.glyphCount; i++) size += GetPixelDataSize(font.glyphs[i].image.width, font.glyphs[i].image.height, font.glyphs[i].image.format);
+
+    if (font.kerningTable != NULL) size += font.kerningTableSize*sizeof(GlyphKerning);
+
+    return size;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+// Load font from binary font file data (.rfnt), no glyphs rasterization required
+// NOTE: Atlas texture is uploaded directly from file data, glyphs images are taken from atlas (uncompressed formats only)
+static Font LoadFontRFNT(const unsigned char *fileData, int dataSize)
+{
+    Font font = { 0 };
+    FontFileHeader header = { 0 };
+
+    if ((fileData == NULL) || (dataSize < (int)sizeof(FontFileHeader))) return font;
+
+    memcpy(&header, fileData, sizeof(FontFileHeader));
+
+    if ((header.id != RFNT_FILE_ID) || (header.version != RFNT_FILE_VERSION))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Binary font file not valid or version not supported");
+        return font;
+    }
+
+    // Check header values, glyphs indices are stored as unsigned short in kerning pairs
+    bool valid = (header.baseSize > 0) && (header.glyphCount > 0) && (header.glyphCount < 0xffff) && (header.glyphPadding >= 0) &&
+                 (header.kerningTableSize >= 0) && (header.atlasWidth > 0) && (header.atlasHeight > 0) &&
+                 (header.atlasFormat >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (header.atlasFormat <= PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) &&
+                 (header.atlasMipmaps >= 1) && (header.atlasMipmaps <= 32);
+
+    // Check atlas pixel data size for all mipmap levels and data size for file contents:
+    // header, glyphs, kerning table and atlas pixel data
+    // NOTE: Atlas pixels count is limited to avoid int overflow on GetPixelDataSize()
+    if (valid && (((long long)header.atlasWidth*header.atlasHeight*GetPixelDataSize(4, 4, header.atlasFormat)/2) > 0x7fffffff)) valid = false;
+
+    if (valid)
+    {
+        long long atlasDataSize = 0;
+        int mipWidth = header.atlasWidth;
+        int mipHeight = header.atlasHeight;
+
+        for (int i = 0; i < header.atlasMipmaps; i++)
+        {
+            atlasDataSize += GetPixelDataSize(mipWidth, mipHeight, header.atlasFormat);
+
+            mipWidth /= 2;
+            mipHeight /= 2;
+            if (mipWidth < 1) mipWidth = 1;
+            if (mipHeight < 1) mipHeight = 1;
+        }
+
+        long long expectedSize = (long long)sizeof(FontFileHeader) + (long long)header.glyphCount*sizeof(FontFileGlyph) +
+                                 (long long)header.kerningTableSize*sizeof(GlyphKerning) + atlasDataSize;
+
+        valid = (header.atlasDataSize == atlasDataSize) && (expectedSize == dataSize);
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Binary font file data not valid");
+        return font;
+    }
+
+    const unsigned char *glyphsData = fileData + sizeof(FontFileHeader);
+    const unsigned char *kerningData = glyphsData + header.glyphCount*sizeof(FontFileGlyph);
+    const unsigned char *atlasData = kerningData + header.kerningTableSize*sizeof(GlyphKerning);
+
+    font.baseSize = header.baseSize;
+    font.glyphCount = header.glyphCount;
+    font.glyphPadding = header.glyphPadding;
+    font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_MALLOC(font.glyphCount*sizeof(Rectangle));
+
+    for (int i = 0; (i < font.glyphCount) && valid; i++)
+    {
+        FontFileGlyph glyph = { 0 };
+        memcpy(&glyph, glyphsData + i*sizeof(FontFileGlyph), sizeof(FontFileGlyph));
+
+        // Glyph rectangle must be inside atlas with integer values, glyphs images are taken from atlas
+        // NOTE: Comparisons are written to also reject NaN values
+        if (!((glyph.x >= 0.0f) && (glyph.y >= 0.0f) && (glyph.width >= 0.0f) && (glyph.height >= 0.0f) &&
+              ((glyph.x + glyph.width) <= (float)header.atlasWidth) && ((glyph.y + glyph.height) <= (float)header.atlasHeight)) ||
+            ((float)(int)glyph.x != glyph.x) || ((float)(int)glyph.y != glyph.y) ||
+            ((float)(int)glyph.width != glyph.width) || ((float)(int)glyph.height != glyph.height))
+        {
+            valid = false;
+            break;
+        }
+
+        font.glyphs[i].value = glyph.value;
+        font.glyphs[i].offsetX = glyph.offsetX;
+        font.glyphs[i].offsetY = glyph.offsetY;
+        font.glyphs[i].advanceX = glyph.advanceX;
+        font.recs[i] = (Rectangle){ glyph.x, glyph.y, glyph.width, glyph.height };
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Binary font file glyphs data not valid");
+
+        RL_FREE(font.glyphs);
+        RL_FREE(font.recs);
+
+        return (Font){ 0 };
+    }
+
+    // NOTE: Image data is only read by texture upload, no copy required
+    Image atlas = { (void *)atlasData, header.atlasWidth, header.atlasHeight, header.atlasMipmaps, header.atlasFormat };
+
+    font.texture = LoadTextureFromImage(atlas);
+
+    if (font.texture.id == 0)
+    {
+        RL_FREE(font.glyphs);
+        RL_FREE(font.recs);
+
+        return (Font){ 0 };
+    }
+
+    // Glyphs images are required by ImageDrawText(), only available for uncompressed atlas
+    if (header.atlasFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        for (int i = 0; i < font.glyphCount; i++) font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
+    }
+
+    // Kerning pairs hash table is generated again from stored pairs, table from file is not trusted for lookups
+    if (header.kerningTableSize > 0)
+    {
+        GlyphKerning *pairs = (GlyphKerning *)RL_MALLOC(header.kerningTableSize*sizeof(GlyphKerning));
+        int pairCount = 0;
+
+        for (int i = 0; i < header.kerningTableSize; i++)
+        {
+            GlyphKerning pair = { 0 };
+            memcpy(&pair, kerningData + i*sizeof(GlyphKerning), sizeof(GlyphKerning));
+
+            // NOTE: Empty table entries (0xffff) are also skipped
+            if ((pair.first < font.glyphCount) && (pair.second < font.glyphCount)) pairs[pairCount++] = pair;
+        }
+
+        font.kerningTable = GenKerningTable(pairs, pairCount, &font.kerningTableSize);
+
+        RL_FREE(pairs);
+    }
+
+    return font;
+}
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_BDF)
 
 // Convert hexadecimal to decimal (single digit)
@@ -2564,4 +3483,842 @@ static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, i
 }
 #endif      // SUPPORT_FILEFORMAT_BDF
 
+#if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
+// Pack font atlas rectangles using skyline bottom-left algorithm, returns packed height (-1 if some rectangle does not fit)
+// NOTE: Rectangles should be sorted by height (higher first), skyline nodes array must fit (count + 1) nodes
+static int PackFontAtlasRecs(FontAtlasRec *recs, int count, int atlasWidth, FontAtlasNode *nodes)
+{
+    int nodeCount = 1;
+    int height = 0;
+
+    nodes[0] = (FontAtlasNode){ 0, 0, atlasWidth };
+
+    for (int i = 0; i < count; i++)
+    {
+        int bestNode = -1;
+        int bestY = 0;
+
+        // Find lowest position for rectangle, leftmost on ties
+        for (int n = 0; n < nodeCount; n++)
+        {
+            if ((nodes[n].x + recs[i].width) > atlasWidth) break;
+
+            // Rectangle is placed on top of highest node below it
+            int y = 0;
+            for (int k = n, left = recs[i].width; left > 0; k++)
+            {
+                if (nodes[k].y > y) y = nodes[k].y;
+                left -= nodes[k].width;
+            }
+
+            if ((bestNode == -1) || (y < bestY))
+            {
+                bestNode = n;
+                bestY = y;
+            }
+        }
+
+        if (bestNode == -1) return -1;
+
+        recs[i].x = nodes[bestNode].x;
+        recs[i].y = bestY;
+
+        if ((bestY + recs[i].height) > height) height = bestY + recs[i].height;
+
+        // Update skyline, nodes below rectangle are replaced by a new node on rectangle top
+        int right = recs[i].x + recs[i].width;
+        int last = bestNode;
+
+        while ((last < nodeCount) && ((nodes[last].x + nodes[last].width) <= right)) last++;
+
+        if ((last < nodeCount) && (nodes[last].x < right))
+        {
+            nodes[last].width -= (right - nodes[last].x);
+            nodes[last].x = right;
+        }
+
+        memmove(&nodes[bestNode + 1], &nodes[last], (nodeCount - last)*sizeof(FontAtlasNode));
+        nodes[bestNode] = (FontAtlasNode){ recs[i].x, bestY + recs[i].height, recs[i].width };
+        nodeCount += (1 - (last - bestNode));
+
+        // Merge contiguous nodes with same height
+        for (int n = 0; n < (nodeCount - 1);)
+        {
+            if (nodes[n].y == nodes[n + 1].y)
+            {
+                nodes[n].width += nodes[n + 1].width;
+                memmove(&nodes[n + 1], &nodes[n + 2], (nodeCount - n - 2)*sizeof(FontAtlasNode));
+                nodeCount--;
+            }
+            else n++;
+        }
+    }
+
+    return height;
+}
+
+// Compare font atlas rectangles by height and width (bigger first), glyph index on ties for a stable order
+static int CompareFontAtlasRecs(const void *a, const void *b)
+{
+    const FontAtlasRec *recA = (const FontAtlasRec *)a;
+    const FontAtlasRec *recB = (const FontAtlasRec *)b;
+
+    if (recA->height != recB->height) return (recB->height - recA->height);
+    if (recA->width != recB->width) return (recB->width - recA->width);
+
+    return (recA->id - recB->id);
+}
+#endif
+
+// Generate text layout glyphs quads, same glyphs placement as DrawTextEx()
+// NOTE: Layout arrays must be allocated for text length, quads vertex are relative to layout origin
+// NOTE: Layout size is measured same as MeasureTextEx() (trailing spaces included), except
+// the space where a line is wrapped, not included on any line
+static void GenTextLayout(TextLayout *layout)
+{
+    Font font = layout->font;
+    float scaleFactor = layout->fontSize/font.baseSize;     // Character quad scaling factor
+    float lineHeight = layout->fontSize + (float)layout->lineSpacing;
+    float padding = (float)font.glyphPadding;
+    float textureWidth = (float)font.texture.width;
+    float textureHeight = (float)font.texture.height;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    DynamicFont *dynamicFont = GetDynamicFont(font);   // Dynamic fonts glyphs are rasterized on demand
+
+    if (dynamicFont != NULL)
+    {
+        padding = (float)dynamicFont->padding;
+        textureWidth = (float)DYNAMIC_FONT_PAGE_SIZE;
+        textureHeight = (float)DYNAMIC_FONT_PAGE_SIZE;
+    }
+#endif
+
+    float penX = 0.0f;              // Current glyph position X
+    float penY = 0.0f;              // Current line position Y
+    float breakX = 0.0f;            // Position X after last space on current line
+    int breakGlyph = -1;            // First glyph after last space on current line (-1 for no space)
+
+    // Line measures, same as MeasureTextEx(): glyphs advance (font base size) and glyphs count
+    float lineMeasure = 0.0f;       // Current line glyphs advance
+    int lineGlyphs = 0;             // Current line glyphs count
+    float breakMeasure = 0.0f;      // Current line glyphs advance before last space
+    int breakGlyphs = 0;            // Current line glyphs count before last space
+    float spaceMeasure = 0.0f;      // Current line glyphs advance up to last space (included)
+    int spaceGlyphs = 0;            // Current line glyphs count up to last space (included)
+    float maxMeasure = 0.0f;        // Longest line glyphs advance
+    int maxGlyphs = 0;              // Longest line glyphs count
+    int previousIndex = -1;         // Previous glyph index on line, required for kerning
+    int lineCount = 1;
+    int length = TextLength(layout->text);
+
+    layout->glyphCount = 0;
+    layout->size = (Vector2){ 0.0f, 0.0f };
+
+    for (int i = 0; i < length;)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&layout->text[i], &codepointByteCount);
+        i += codepointByteCount;
+
+        if (codepoint == '\n')
+        {
+            if (maxMeasure < lineMeasure) maxMeasure = lineMeasure;
+            if (maxGlyphs < lineGlyphs) maxGlyphs = lineGlyphs;
+
+            penX = 0.0f;
+            penY += lineHeight;
+            lineMeasure = 0.0f;
+            lineGlyphs = 0;
+            breakGlyph = -1;
+            previousIndex = -1;
+            lineCount++;
+            continue;
+        }
+
+        // Get glyph metrics and atlas rectangle, same as DrawTextCodepoint()
+        Rectangle srcRec = { 0 };
+        float offsetX = 0.0f;
+        float offsetY = 0.0f;
+        float advance = 0.0f;
+        float kerning = 0.0f;
+        float measure = 0.0f;       // Glyph advance as measured by MeasureTextEx()
+        bool visible = ((codepoint != ' ') && (codepoint != '\t'));
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if (dynamicFont != NULL)
+        {
+            int index = GetDynamicGlyph(dynamicFont, codepoint, false, NULL);
+
+            if (index != -1)
+            {
+                const DynamicGlyph *glyph = &dynamicFont->glyphs[index];
+
+                srcRec = glyph->rec;
+                offsetX = (float)glyph->offsetX;
+                offsetY = (float)glyph->offsetY;
+                advance = (glyph->advanceX == 0)? glyph->rec.width*scaleFactor : glyph->advanceX*scaleFactor;
+                measure = (glyph->advanceX == 0)? (glyph->rec.width + glyph->offsetX) : (float)glyph->advanceX;
+                if (glyph->shelf == -1) visible = false;
+            }
+            else visible = false;
+        }
+        else
+#endif
+        {
+            int index = GetGlyphIndex(font, codepoint);
+
+            kerning = GetKerningAdvance(font, previousIndex, index);
+            penX += kerning*scaleFactor;
+            previousIndex = index;
+
+            srcRec = font.recs[index];
+            offsetX = (float)font.glyphs[index].offsetX;
+            offsetY = (float)font.glyphs[index].offsetY;
+            advance = (font.glyphs[index].advanceX == 0)? font.recs[index].width*scaleFactor : font.glyphs[index].advanceX*scaleFactor;
+            measure = (font.glyphs[index].advanceX == 0)? (font.recs[index].width + font.glyphs[index].offsetX) : (float)font.glyphs[index].advanceX;
+        }
+
+        if ((codepoint == ' ') || (codepoint == '\t'))
+        {
+            breakMeasure = lineMeasure;
+            breakGlyphs = lineGlyphs;
+            lineMeasure += (kerning + measure);
+            lineGlyphs++;
+            spaceMeasure = lineMeasure;
+            spaceGlyphs = lineGlyphs;
+
+            penX += (advance + layout->spacing);
+            breakX = penX;
+            breakGlyph = layout->glyphCount;
+            continue;
+        }
+
+        // Wrap line if glyph exceeds wrap width, moving glyphs after last space to next line
+        if ((layout->wrapWidth > 0.0f) && (penX > 0.0f) && ((penX + advance) > layout->wrapWidth))
+        {
+            float shift = penX;
+            float nextMeasure = 0.0f;
+            int nextGlyphs = 0;
+
+            // Glyphs after last space are moved to next line, last space is not measured
+            if (breakGlyph != -1)
+            {
+                shift = breakX;
+                nextMeasure = lineMeasure - spaceMeasure;
+                nextGlyphs = lineGlyphs - spaceGlyphs;
+                lineMeasure = breakMeasure;
+                lineGlyphs = breakGlyphs;
+            }
+            else
+            {
+                breakGlyph = layout->glyphCount;
+                kerning = 0.0f;     // Previous glyph is left on previous line
+            }
+
+            if (maxMeasure < lineMeasure) maxMeasure = lineMeasure;
+            if (maxGlyphs < lineGlyphs) maxGlyphs = lineGlyphs;
+
+            for (int g = 8*breakGlyph; g < 8*layout->glyphCount; g += 2)
+            {
+                layout->vertices[g] -= shift;
+                layout->vertices[g + 1] += lineHeight;
+            }
+
+            penX -= shift;
+            penY += lineHeight;
+            lineMeasure = nextMeasure;
+            lineGlyphs = nextGlyphs;
+            breakGlyph = -1;
+            lineCount++;
+        }
+
+        if (visible)
+        {
+            // NOTE: We consider glyph padding on drawing, same as DrawTextCodepoint()
+            float x0 = penX + (offsetX - padding)*scaleFactor;
+            float y0 = penY + (offsetY - padding)*scaleFactor;
+            float x1 = x0 + (srcRec.width + 2.0f*padding)*scaleFactor;
+            float y1 = y0 + (srcRec.height + 2.0f*padding)*scaleFactor;
+
+            float left = (srcRec.x - padding)/textureWidth;
+            float right = (srcRec.x + srcRec.width + padding)/textureWidth;
+            float top = (srcRec.y - padding)/textureHeight;
+            float bottom = (srcRec.y + srcRec.height + padding)/textureHeight;
+
+            // Quad vertex: top-left, bottom-left, bottom-right, top-right
+            float *vertex = layout->vertices + 8*layout->glyphCount;
+            vertex[0] = x0; vertex[1] = y0;
+            vertex[2] = x0; vertex[3] = y1;
+            vertex[4] = x1; vertex[5] = y1;
+            vertex[6] = x1; vertex[7] = y0;
+
+            float *texcoord = layout->texcoords + 8*layout->glyphCount;
+            texcoord[0] = left; texcoord[1] = top;
+            texcoord[2] = left; texcoord[3] = bottom;
+            texcoord[4] = right; texcoord[5] = bottom;
+            texcoord[6] = right; texcoord[7] = top;
+
+            layout->codepoints[layout->glyphCount] = codepoint;
+            layout->glyphCount++;
+        }
+
+        lineMeasure += (kerning + measure);
+        lineGlyphs++;
+        penX += (advance + layout->spacing);
+    }
+
+    if (maxMeasure < lineMeasure) maxMeasure = lineMeasure;
+    if (maxGlyphs < lineGlyphs) maxGlyphs = lineGlyphs;
+
+    // NOTE: Spacing is added for longest line glyphs count, same as MeasureTextEx()
+    if (maxGlyphs > 0) layout->size.x = maxMeasure*scaleFactor + (float)(maxGlyphs - 1)*layout->spacing;
+    layout->size.y = lineCount*layout->fontSize + (lineCount - 1)*(float)layout->lineSpacing;
+}
+
+// Get kerning pairs hash table hash for glyphs pair
+static unsigned int GetKerningHash(int first, int second)
+{
+    unsigned int hash = ((unsigned int)first*2654435761u) ^ ((unsigned int)second*2246822519u);
+
+    return (hash ^ (hash >> 15));
+}
+
+// Generate kerning pairs hash table, open addressing with linear probing, load factor <= 0.5
+// NOTE: Pairs must be valid glyphs indices pairs (not 0xffff), NULL is returned if no pairs provided
+static GlyphKerning *GenKerningTable(const GlyphKerning *pairs, int pairCount, int *tableSize)
+{
+    GlyphKerning *table = NULL;
+
+    *tableSize = 0;
+
+    if (pairCount > 0)
+    {
+        int size = 16;
+        while (size < 2*pairCount) size *= 2;
+
+        table = (GlyphKerning *)RL_MALLOC(size*sizeof(GlyphKerning));
+        for (int i = 0; i < size; i++) table[i] = (GlyphKerning){ 0xffff, 0xffff, 0.0f };
+
+        for (int i = 0; i < pairCount; i++)
+        {
+            unsigned int slot = GetKerningHash(pairs[i].first, pairs[i].second) & (size - 1);
+
+            while (table[slot].first != 0xffff) slot = (slot + 1) & (size - 1);
+
+            table[slot] = pairs[i];
+        }
+
+        *tableSize = size;
+    }
+
+    return table;
+}
+
+// Get kerning advance adjustment between two glyphs (for font base size), 0 if no kerning pair
+static float GetKerningAdvance(Font font, int first, int second)
+{
+    if ((font.kerningTable == NULL) || (first < 0) || (second < 0)) return 0.0f;
+
+    unsigned int mask = (unsigned int)font.kerningTableSize - 1;
+    unsigned int slot = GetKerningHash(first, second) & mask;
+
+    // NOTE: Table load factor is kept <= 0.5, so empty entries are always found
+    while (font.kerningTable[slot].first != 0xffff)
+    {
+        if ((font.kerningTable[slot].first == first) && (font.kerningTable[slot].second == second)) return font.kerningTable[slot].advance;
+
+        slot = (slot + 1) & mask;
+    }
+
+    return 0.0f;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Get dynamic font data for a font, NULL if font is not dynamic
+static DynamicFont *GetDynamicFont(Font font)
+{
+    if (font.texture.id == 0) return NULL;
+
+    for (int i = 0; i < MAX_DYNAMIC_FONTS; i++)
+    {
+        if (dynamicFonts[i].id == font.texture.id) return &dynamicFonts[i];
+    }
+
+    return NULL;
+}
+
+// Unload dynamic font data, first atlas page is not unloaded (font texture)
+static void UnloadDynamicFont(DynamicFont *dynamicFont)
+{
+    for (int i = 1; i < dynamicFont->pageCount; i++) UnloadTexture(dynamicFont->pages[i]);
+
+    RL_FREE(dynamicFont->fileData);
+    RL_FREE(dynamicFont->shelves);
+    RL_FREE(dynamicFont->glyphs);
+
+    memset(dynamicFont, 0, sizeof(DynamicFont));
+}
+
+// Add dynamic font atlas page, returns false if maximum number of pages reached
+static bool AddDynamicFontPage(DynamicFont *dynamicFont)
+{
+    if (dynamicFont->pageCount >= MAX_DYNAMIC_FONT_PAGES) return false;
+
+    // Atlas page initialized to white transparent pixels
+    Image image = { 0 };
+    image.data = RL_CALLOC(DYNAMIC_FONT_PAGE_SIZE*DYNAMIC_FONT_PAGE_SIZE, 2);
+    image.width = DYNAMIC_FONT_PAGE_SIZE;
+    image.height = DYNAMIC_FONT_PAGE_SIZE;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+    for (int i = 0; i < DYNAMIC_FONT_PAGE_SIZE*DYNAMIC_FONT_PAGE_SIZE; i++) ((unsigned char *)image.data)[2*i] = 255;
+
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    if (texture.id == 0) return false;
+
+    dynamicFont->pages[dynamicFont->pageCount] = texture;
+    dynamicFont->pageHeights[dynamicFont->pageCount] = 0;
+    dynamicFont->pageCount++;
+
+    return true;
+}
+
+// Add dynamic font atlas shelf on page, returns shelf index
+static int AddDynamicFontShelf(DynamicFont *dynamicFont, int page, int height, bool pinned)
+{
+    if (dynamicFont->shelfCount >= dynamicFont->shelfCapacity)
+    {
+        dynamicFont->shelfCapacity = (dynamicFont->shelfCapacity > 0)? 2*dynamicFont->shelfCapacity : 32;
+        dynamicFont->shelves = (DynamicFontShelf *)RL_REALLOC(dynamicFont->shelves, dynamicFont->shelfCapacity*sizeof(DynamicFontShelf));
+    }
+
+    DynamicFontShelf *shelf = &dynamicFont->shelves[dynamicFont->shelfCount];
+
+    shelf->page = page;
+    shelf->y = dynamicFont->pageHeights[page];
+    shelf->height = height;
+    shelf->width = 0;
+    shelf->lastUse = dynamicFont->useStamp;
+    shelf->pinned = pinned;
+
+    dynamicFont->pageHeights[page] += height;
+
+    return dynamicFont->shelfCount++;
+}
+
+// Get dynamic font atlas shelf with space for a glyph image (padding included), returns -1 if no space
+// NOTE: Shelves are filled left to right, new shelves are added to atlas pages top to bottom,
+// when all pages are full the least recently used shelf is evicted and reused
+static int GetDynamicFontShelf(DynamicFont *dynamicFont, int width, int height, bool pinned)
+{
+    if ((width > DYNAMIC_FONT_PAGE_SIZE) || (height > DYNAMIC_FONT_PAGE_SIZE)) return -1;
+
+    int best = -1;
+
+    // Look for best fitting shelf, avoiding too much wasted space
+    for (int i = 0; i < dynamicFont->shelfCount; i++)
+    {
+        const DynamicFontShelf *shelf = &dynamicFont->shelves[i];
+
+        if ((shelf->pinned == pinned) && (shelf->height >= height) && (2*shelf->height <= 3*height) &&
+            ((shelf->width + width) <= DYNAMIC_FONT_PAGE_SIZE) && ((best == -1) || (shelf->height < dynamicFont->shelves[best].height))) best = i;
+    }
+
+    if (best != -1) return best;
+
+    // Add new shelf on first page with space available
+    for (int i = 0; i < dynamicFont->pageCount; i++)
+    {
+        if ((dynamicFont->pageHeights[i] + height) <= DYNAMIC_FONT_PAGE_SIZE) return AddDynamicFontShelf(dynamicFont, i, height, pinned);
+    }
+
+    // Look for any shelf with space available
+    for (int i = 0; i < dynamicFont->shelfCount; i++)
+    {
+        const DynamicFontShelf *shelf = &dynamicFont->shelves[i];
+
+        if ((shelf->pinned == pinned) && (shelf->height >= height) && ((shelf->width + width) <= DYNAMIC_FONT_PAGE_SIZE) &&
+            ((best == -1) || (shelf->height < dynamicFont->shelves[best].height))) best = i;
+    }
+
+    if (best != -1) return best;
+
+    // Add new atlas page
+    if (AddDynamicFontPage(dynamicFont)) return AddDynamicFontShelf(dynamicFont, dynamicFont->pageCount - 1, height, pinned);
+
+    // Evict least recently used shelf
+    if (!pinned)
+    {
+        for (int i = 0; i < dynamicFont->shelfCount; i++)
+        {
+            const DynamicFontShelf *shelf = &dynamicFont->shelves[i];
+
+            if (!shelf->pinned && (shelf->height >= height) && ((best == -1) || (shelf->lastUse < dynamicFont->shelves[best].lastUse))) best = i;
+        }
+
+        if (best != -1) EvictDynamicFontShelf(dynamicFont, best);
+    }
+
+    return best;
+}
+
+// Evict all glyphs on dynamic font atlas shelf, shelf space is reused
+static void EvictDynamicFontShelf(DynamicFont *dynamicFont, int shelf)
+{
+    // Evicted glyphs could be referenced by current render batch, it must be drawn before updating the atlas
+    rlDrawRenderBatchActive();
+
+    for (int i = 0; i < DYNAMIC_FONT_HASH_SIZE; i++)
+    {
+        int *link = &dynamicFont->buckets[i];
+
+        while (*link != -1)
+        {
+            DynamicGlyph *glyph = &dynamicFont->glyphs[*link];
+
+            if (glyph->shelf == shelf)
+            {
+                int index = *link;
+
+                *link = glyph->next;
+                glyph->next = dynamicFont->freeGlyph;
+                dynamicFont->freeGlyph = index;
+            }
+            else link = &glyph->next;
+        }
+    }
+
+    dynamicFont->shelves[shelf].width = 0;
+
+    TRACELOGD("FONT: Dynamic font atlas full, glyphs evicted from page %i", dynamicFont->shelves[shelf].page);
+}
+
+// Get dynamic font glyph for a codepoint, rasterized and added to atlas on first use
+// NOTE: Returns glyph index (valid until next glyph request), -1 if glyph could not be added to atlas,
+// if codepoint is not found in the font it fallbacks to '?', glyph image is provided (optional) only on rasterization
+static int GetDynamicGlyph(DynamicFont *dynamicFont, int codepoint, bool pinned, Image *image)
+{
+    unsigned int bucket = ((unsigned int)codepoint*2654435761u) & (DYNAMIC_FONT_HASH_SIZE - 1);
+
+    for (int i = dynamicFont->buckets[bucket]; i != -1; i = dynamicFont->glyphs[i].next)
+    {
+        if (dynamicFont->glyphs[i].codepoint == codepoint)
+        {
+            if (dynamicFont->glyphs[i].shelf != -1) dynamicFont->shelves[dynamicFont->glyphs[i].shelf].lastUse = ++dynamicFont->useStamp;
+
+            return i;
+        }
+    }
+
+    // Glyph not found in cache, rasterize it
+    int glyphIndex = stbtt_FindGlyphIndex(&dynamicFont->info, codepoint);
+
+    if (glyphIndex == 0) return (codepoint != '?')? GetDynamicGlyph(dynamicFont, '?', pinned, NULL) : -1;
+
+    DynamicGlyph glyph = { 0 };
+    glyph.codepoint = codepoint;
+    glyph.shelf = -1;
+
+    int width = 0, height = 0;
+    unsigned char *bitmap = NULL;
+
+    stbtt_GetGlyphHMetrics(&dynamicFont->info, glyphIndex, &glyph.advanceX, NULL);
+    glyph.advanceX = (int)((float)glyph.advanceX*dynamicFont->scale);
+
+    if (codepoint != ' ') bitmap = stbtt_GetGlyphBitmap(&dynamicFont->info, dynamicFont->scale, dynamicFont->scale, glyphIndex, &width, &height, &glyph.offsetX, &glyph.offsetY);
+
+    glyph.offsetY += dynamicFont->ascent;
+
+    if (bitmap != NULL)
+    {
+        int padding = dynamicFont->padding;
+        int paddedWidth = width + 2*padding;
+        int paddedHeight = height + 2*padding;
+
+        glyph.shelf = GetDynamicFontShelf(dynamicFont, paddedWidth, paddedHeight, pinned);
+
+        if (glyph.shelf != -1)
+        {
+            DynamicFontShelf *shelf = &dynamicFont->shelves[glyph.shelf];
+
+            // Glyph image with padding, white pixels with glyph alpha
+            unsigned char *pixels = (unsigned char *)RL_CALLOC(paddedWidth*paddedHeight, 2);
+
+            for (int i = 0; i < paddedWidth*paddedHeight; i++) pixels[2*i] = 255;
+
+            for (int y = 0; y < height; y++)
+            {
+                for (int x = 0; x < width; x++) pixels[2*((y + padding)*paddedWidth + x + padding) + 1] = bitmap[y*width + x];
+            }
+
+            UpdateTextureRec(dynamicFont->pages[shelf->page], (Rectangle){ (float)shelf->width, (float)shelf->y, (float)paddedWidth, (float)paddedHeight }, pixels);
+
+            glyph.rec = (Rectangle){ (float)(shelf->width + padding), (float)(shelf->y + padding), (float)width, (float)height };
+            shelf->width += paddedWidth;
+            shelf->lastUse = ++dynamicFont->useStamp;
+
+            if (image != NULL)
+            {
+                *image = ImageFromImage((Image){ pixels, paddedWidth, paddedHeight, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA },
+                                        (Rectangle){ (float)padding, (float)padding, (float)width, (float)height });
+            }
+
+            RL_FREE(pixels);
+        }
+
+        stbtt_FreeBitmap(bitmap, NULL);
+
+        if (glyph.shelf == -1)
+        {
+            TRACELOG(LOG_WARNING, "FONT: Dynamic font atlas full, glyph %i could not be added", codepoint);
+            return -1;
+        }
+    }
+
+    // Add glyph to cache
+    int index = dynamicFont->freeGlyph;
+
+    if (index != -1) dynamicFont->freeGlyph = dynamicFont->glyphs[index].next;
+    else
+    {
+        if (dynamicFont->glyphCount >= dynamicFont->glyphCapacity)
+        {
+            dynamicFont->glyphCapacity = (dynamicFont->glyphCapacity > 0)? 2*dynamicFont->glyphCapacity : 256;
+            dynamicFont->glyphs = (DynamicGlyph *)RL_REALLOC(dynamicFont->glyphs, dynamicFont->glyphCapacity*sizeof(DynamicGlyph));
+        }
+
+        index = dynamicFont->glyphCount++;
+    }
+
+    glyph.next = dynamicFont->buckets[bucket];
+    dynamicFont->glyphs[index] = glyph;
+    dynamicFont->buckets[bucket] = index;
+
+    return index;
+}
+
+// Draw one character (codepoint) using dynamic font, returns character advance (scaled)
+static float DrawTextCodepointDynamic(DynamicFont *dynamicFont, int codepoint, Vector2 position, float fontSize, Color tint)
+{
+    int index = GetDynamicGlyph(dynamicFont, codepoint, false, NULL);
+
+    if (index == -1) return 0.0f;
+
+    const DynamicGlyph *glyph = &dynamicFont->glyphs[index];
+    float scaleFactor = fontSize/dynamicFont->baseSize;
+
+    if ((glyph->shelf != -1) && (codepoint != ' ') && (codepoint != '\t'))
+    {
+        float padding = (float)dynamicFont->padding;
+
+        // NOTE: We consider glyph padding on drawing, same as DrawTextCodepoint()
+        Rectangle dstRec = { position.x + glyph->offsetX*scaleFactor - padding*scaleFactor,
+                             position.y + glyph->offsetY*scaleFactor - padding*scaleFactor,
+                             (glyph->rec.width + 2.0f*padding)*scaleFactor,
+                             (glyph->rec.height + 2.0f*padding)*scaleFactor };
+
+        Rectangle srcRec = { glyph->rec.x - padding, glyph->rec.y - padding, glyph->rec.width + 2.0f*padding, glyph->rec.height + 2.0f*padding };
+
+        DrawTexturePro(dynamicFont->pages[dynamicFont->shelves[glyph->shelf].page], srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    }
+
+    if (glyph->advanceX == 0) return glyph->rec.width*scaleFactor;
+    else return glyph->advanceX*scaleFactor;
+}
+
+#if defined(SUPPORT_FONT_KERNING)
+// Load font kerning pairs for font glyphs, returns kerning pairs hash table (NULL if no kerning)
+// NOTE: GPOS kerning can only be queried by glyphs pair, so all glyphs pairs are queried
+// if glyphs count is small enough, legacy 'kern' table pairs are directly extracted
+static GlyphKerning *LoadFontKerning(const unsigned char *fileData, int fontSize, const GlyphInfo *glyphs, int glyphCount, int *tableSize)
+{
+    GlyphKerning *table = NULL;
+    stbtt_fontinfo fontInfo = { 0 };
+
+    *tableSize = 0;
+
+    // NOTE: Glyphs indices are stored as unsigned short, 0xffff is used for empty table entries
+    if ((glyphs == NULL) || (glyphCount >= 0xffff) || !stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0)) return NULL;
+    if ((fontInfo.gpos == 0) && (fontInfo.kern == 0)) return NULL;
+
+    float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
+
+    // Glyphs indices in TTF font, 0 for glyphs not available in the font
+    int *fontIndices = (int *)RL_MALLOC(glyphCount*sizeof(int));
+    for (int i = 0; i < glyphCount; i++) fontIndices[i] = stbtt_FindGlyphIndex(&fontInfo, glyphs[i].value);
+
+    GlyphKerning *pairs = NULL;
+    int pairCount = 0;
+    int pairCapacity = 0;
+
+    if (fontInfo.gpos != 0)
+    {
+        if (glyphCount <= FONT_KERNING_GPOS_MAX_GLYPHS)
+        {
+            for (int a = 0; a < glyphCount; a++)
+            {
+                if (fontIndices[a] == 0) continue;
+
+                for (int b = 0; b < glyphCount; b++)
+                {
+                    if (fontIndices[b] == 0) continue;
+
+                    int advance = stbtt_GetGlyphKernAdvance(&fontInfo, fontIndices[a], fontIndices[b]);
+
+                    if (advance != 0)
+                    {
+                        if (pairCount >= pairCapacity)
+                        {
+                            pairCapacity = (pairCapacity > 0)? 2*pairCapacity : 256;
+                            pairs = (GlyphKerning *)RL_REALLOC(pairs, pairCapacity*sizeof(GlyphKerning));
+                        }
+
+                        pairs[pairCount++] = (GlyphKerning){ (unsigned short)a, (unsigned short)b, (float)advance*scaleFactor };
+                    }
+                }
+            }
+        }
+        else TRACELOG(LOG_INFO, "FONT: Kerning (GPOS) not loaded, too many glyphs to query (%i)", glyphCount);
+    }
+    else
+    {
+        // Font glyphs by TTF font glyph index, -1 for glyphs not loaded
+        int *glyphIndices = (int *)RL_MALLOC(fontInfo.numGlyphs*sizeof(int));
+        for (int i = 0; i < fontInfo.numGlyphs; i++) glyphIndices[i] = -1;
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            if ((fontIndices[i] > 0) && (fontIndices[i] < fontInfo.numGlyphs) && (glyphIndices[fontIndices[i]] == -1)) glyphIndices[fontIndices[i]] = i;
+        }
+
+        int entryCount = stbtt_GetKerningTableLength(&fontInfo);
+        stbtt_kerningentry *entries = (stbtt_kerningentry *)RL_MALLOC(((entryCount > 0)? entryCount : 1)*sizeof(stbtt_kerningentry));
+        entryCount = stbtt_GetKerningTable(&fontInfo, entries, entryCount);
+
+        pairs = (GlyphKerning *)RL_MALLOC(((entryCount > 0)? entryCount : 1)*sizeof(GlyphKerning));
+
+        for (int i = 0; i < entryCount; i++)
+        {
+            if ((entries[i].glyph1 < 0) || (entries[i].glyph1 >= fontInfo.numGlyphs) ||
+                (entries[i].glyph2 < 0) || (entries[i].glyph2 >= fontInfo.numGlyphs) || (entries[i].advance == 0)) continue;
+
+            int a = glyphIndices[entries[i].glyph1];
+            int b = glyphIndices[entries[i].glyph2];
+
+            if ((a != -1) && (b != -1)) pairs[pairCount++] = (GlyphKerning){ (unsigned short)a, (unsigned short)b, (float)entries[i].advance*scaleFactor };
+        }
+
+        RL_FREE(entries);
+        RL_FREE(glyphIndices);
+    }
+
+    if (pairCount > 0)
+    {
+        table = GenKerningTable(pairs, pairCount, tableSize);
+
+        TRACELOGD("FONT: Kerning pairs loaded successfully (%i pairs)", pairCount);
+    }
+
+    RL_FREE(pairs);
+    RL_FREE(fontIndices);
+
+    return table;
+}
+#endif
+
+// Rasterize font glyphs job, every glyph is rasterized independently
+static void LoadFontGlyphs(FontGlyphsJob *job)
+{
+    for (int i = job->first; i < job->codepointCount; i += job->stride) LoadFontGlyph(job, i);
+}
+
+#if defined(FONT_THREAD_WIN32)
+static unsigned long __stdcall LoadFontGlyphsThread(void *arg) { LoadFontGlyphs((FontGlyphsJob *)arg); return 0; }
+#elif defined(FONT_THREAD_PTHREAD)
+static void *LoadFontGlyphsThread(void *arg) { LoadFontGlyphs((FontGlyphsJob *)arg); return NULL; }
+#endif
+
+// Rasterize font glyph for job codepoint index
+// NOTE: Only glyph at index is written, required to rasterize glyphs on multiple threads
+static void LoadFontGlyph(const FontGlyphsJob *job, int index)
+{
+    GlyphInfo *glyph = &job->glyphs[index];
+
+    int chw = 0, chh = 0;   // Character width and height (on generation)
+    int ch = job->codepoints[index];    // Character value to get info for
+    glyph->value = ch;
+
+    //  Render a unicode codepoint to a bitmap
+    //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+    //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+    //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+    // Check if a glyph is available in the font
+    // WARNING: if (glyphIndex == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
+    int glyphIndex = stbtt_FindGlyphIndex(job->fontInfo, ch);
+
+    if (glyphIndex > 0)
+    {
+        switch (job->type)
+        {
+            case FONT_DEFAULT:
+            case FONT_BITMAP: glyph->image.data = stbtt_GetCodepointBitmap(job->fontInfo, job->scaleFactor, job->scaleFactor, ch, &chw, &chh, &glyph->offsetX, &glyph->offsetY); break;
+            case FONT_SDF: if (ch != 32) glyph->image.data = stbtt_GetCodepointSDF(job->fontInfo, job->scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &glyph->offsetX, &glyph->offsetY); break;
+            default: break;
+        }
+
+        if (glyph->image.data != NULL)    // Glyph data has been found in the font
+        {
+            stbtt_GetCodepointHMetrics(job->fontInfo, ch, &glyph->advanceX, NULL);
+            glyph->advanceX = (int)((float)glyph->advanceX*job->scaleFactor);
+
+            // Load characters images
+            glyph->image.width = chw;
+            glyph->image.height = chh;
+            glyph->image.mipmaps = 1;
+            glyph->image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+            glyph->offsetY += (int)((float)job->ascent*job->scaleFactor);
+        }
+
+        // NOTE: We create an empty image for space character,
+        // it could be further required for atlas packing
+        if (ch == 32)
+        {
+            stbtt_GetCodepointHMetrics(job->fontInfo, ch, &glyph->advanceX, NULL);
+            glyph->advanceX = (int)((float)glyph->advanceX*job->scaleFactor);
+
+            Image imSpace = {
+                .data = RL_CALLOC(glyph->advanceX*job->fontSize, 2),
+                .width = glyph->advanceX,
+                .height = job->fontSize,
+                .mipmaps = 1,
+                .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+            };
+
+            glyph->image = imSpace;
+        }
+
+        if (job->type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)glyph->image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)glyph->image.data)[p] = 0;
+                else ((unsigned char *)glyph->image.data)[p] = 255;
+            }
+        }
+    }
+    else
+    {
+        // TODO: Use some fallback glyph for codepoints not found in the font
+    }
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXT
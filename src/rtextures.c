@@ -78,6 +78,16 @@
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 
+#if !defined(RLGL_DISABLE_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>          // Required for: SSE intrinsics [Used in DrawTextureBatch()]
+        #define TEXTURE_BATCH_SIMD_SSE
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>           // Required for: NEON intrinsics [Used in DrawTextureBatch()]
+        #define TEXTURE_BATCH_SIMD_NEON
+    #endif
+#endif
+
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -244,15 +254,72 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef MAX_RENDER_TEXTURE_POOL_SIZE
+    #define MAX_RENDER_TEXTURE_POOL_SIZE    32  // Maximum number of render textures kept in pool
+#endif
+#ifndef MAX_MANAGED_TEXTURES
+    #define MAX_MANAGED_TEXTURES           256  // Maximum number of textures with managed residency
+#endif
+#ifndef MANAGED_TEXTURE_EVICT_SCALE
+    #define MANAGED_TEXTURE_EVICT_SCALE      8  // Evicted managed textures resolution divisor
+#endif
+#ifndef MAX_SPRITES_CHUNK_SIZE
+    #define MAX_SPRITES_CHUNK_SIZE         512  // Maximum number of sprites per chunk on DrawTextureBatch()
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Render texture pool, transient render textures reused by size and format
+typedef struct RenderTexturePool {
+    RenderTexture2D targets[MAX_RENDER_TEXTURE_POOL_SIZE];  // Render textures loaded
+    bool inUse[MAX_RENDER_TEXTURE_POOL_SIZE];   // Render texture acquired, not available for reuse
+    int count;                                  // Number of render textures loaded
+    int memory;                                 // Memory size of render textures loaded (bytes)
+    int peakMemory;                             // Peak memory size of render textures loaded (bytes)
+} RenderTexturePool;
+
+// Managed texture, texture residency controlled by memory budget
+// NOTE: Texture id is kept on eviction, only texture storage is replaced
+typedef struct ManagedTexture {
+    Texture2D texture;                          // Texture at full resolution
+    char *fileName;                             // Texture file, reloaded when required (NULL if image kept in RAM)
+    Image image;                                // Texture image at full resolution kept in RAM (not loaded from file)
+    Image evictImage;                           // Texture image at low resolution, loaded on eviction
+    bool evicted;                               // Texture evicted, low resolution version in VRAM
+    int memory;                                 // Texture current memory size (bytes)
+} ManagedTexture;
+
+// Managed textures, least recently used textures are evicted to fit budget
+typedef struct ManagedTextures {
+    ManagedTexture textures[MAX_MANAGED_TEXTURES];  // Managed textures loaded
+    int count;                                  // Number of managed textures loaded
+    int budget;                                 // Memory budget for managed textures (bytes), 0 for no budget
+    int memory;                                 // Memory size of managed textures loaded (bytes)
+} ManagedTextures;
+
+// Sprites chunk, quads generated by DrawTextureBatch()
+// NOTE: Sprites parameters are stored as separate arrays for SIMD processing
+typedef struct SpritesChunk {
+    float x[MAX_SPRITES_CHUNK_SIZE];            // Sprites destination position X
+    float y[MAX_SPRITES_CHUNK_SIZE];            // Sprites destination position Y
+    float dx[MAX_SPRITES_CHUNK_SIZE];           // Sprites origin offset X (negated origin)
+    float dy[MAX_SPRITES_CHUNK_SIZE];           // Sprites origin offset Y (negated origin)
+    float width[MAX_SPRITES_CHUNK_SIZE];        // Sprites destination width
+    float height[MAX_SPRITES_CHUNK_SIZE];       // Sprites destination height
+    float cos[MAX_SPRITES_CHUNK_SIZE];          // Sprites rotation cosine
+    float sin[MAX_SPRITES_CHUNK_SIZE];          // Sprites rotation sine
+    float vertices[8*MAX_SPRITES_CHUNK_SIZE];   // Quads vertex position (XY - 4 vertex per sprite)
+    float texcoords[8*MAX_SPRITES_CHUNK_SIZE];  // Quads vertex texture coordinates (UV - 4 vertex per sprite)
+    unsigned char colors[16*MAX_SPRITES_CHUNK_SIZE]; // Quads vertex colors (RGBA - 4 vertex per sprite)
+} SpritesChunk;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static RenderTexturePool renderTexturePool = { 0 };    // Render textures pool: AcquireRenderTexture()
+static ManagedTextures managedTextures = { 0 };         // Managed textures: LoadTextureManaged()
+static SpritesChunk spritesChunk = { 0 };               // Sprites chunk: DrawTextureBatch()
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -265,6 +332,12 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static RenderTexture2D LoadRenderTextureFormat(int width, int height, int format); // Load texture for rendering with color pixel format
+static int GetRenderTextureMemory(RenderTexture2D target);  // Get render texture memory size in bytes (color and depth)
+static int GetTextureMemory(Texture2D texture);             // Get texture memory size in bytes (including mipmaps)
+static Texture2D LoadManagedTexture(Image image, const char *fileName); // Load texture with managed residency
+static void EvictManagedTexture(ManagedTexture *managed);   // Evict managed texture, replaced by low resolution version
+static void RestoreManagedTexture(ManagedTexture *managed); // Restore managed texture at full resolution
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1573,8 +1646,9 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
 #if defined(SUPPORT_MODULE_RTEXT)
     int size = (int)strlen(text);   // Get size in bytes of text
 
-    int textOffsetX = 0;            // Image drawing position X
+    float textOffsetX = 0.0f;       // Image drawing position X
     int textOffsetY = 0;            // Offset between lines (on linebreak '\n')
+    int previousCodepoint = -1;     // Previous codepoint on line, required for kerning (same as MeasureTextEx())
 
     // NOTE: Text image is generated at font base size, later scaled to desired font size
     Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);  // WARNING: Module required: rtext
@@ -1595,18 +1669,22 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
             // NOTE: Fixed line spacing of 1.5 line-height
             // TODO: Support custom line spacing defined by user
             textOffsetY += (font.baseSize + font.baseSize/2);
-            textOffsetX = 0;
+            textOffsetX = 0.0f;
+            previousCodepoint = -1;
         }
         else
         {
+            if (previousCodepoint != -1) textOffsetX += GetGlyphKerning(font, previousCodepoint, codepoint);   // WARNING: Module required: rtext
+            previousCodepoint = codepoint;
+
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
-                Rectangle rec = { (float)(textOffsetX + font.glyphs[index].offsetX), (float)(textOffsetY + font.glyphs[index].offsetY), (float)font.recs[index].width, (float)font.recs[index].height };
+                Rectangle rec = { (float)((int)textOffsetX + font.glyphs[index].offsetX), (float)(textOffsetY + font.glyphs[index].offsetY), (float)font.recs[index].width, (float)font.recs[index].height };
                 ImageDraw(&imText, font.glyphs[index].image, (Rectangle){ 0, 0, (float)font.glyphs[index].image.width, (float)font.glyphs[index].image.height }, rec, tint);
             }
 
-            if (font.glyphs[index].advanceX == 0) textOffsetX += (int)(font.recs[index].width + spacing);
-            else textOffsetX += font.glyphs[index].advanceX + (int)spacing;
+            if (font.glyphs[index].advanceX == 0) textOffsetX += (float)(int)(font.recs[index].width + spacing);
+            else textOffsetX += (float)(font.glyphs[index].advanceX + (int)spacing);
         }
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint
@@ -4177,6 +4255,8 @@ Texture2D LoadTextureFromImage(Image image)
     texture.mipmaps = image.mipmaps;
     texture.format = image.format;
 
+    if (texture.id > 0) REGISTER_RESOURCE(RESOURCE_TEXTURE, texture.id, texture.id, texture.format, GetTextureMemory(texture), 0, "LoadTexture");
+
     return texture;
 }
 
@@ -4269,6 +4349,8 @@ TextureCubemap LoadTextureCubemap(Image image, int layout)
         {
             cubemap.format = faces.format;
             cubemap.mipmaps = 1;
+
+            REGISTER_RESOURCE(RESOURCE_TEXTURE, cubemap.id, cubemap.id, cubemap.format, 6*GetTextureMemory(cubemap), 0, "LoadTextureCubemap");
         }
         else TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
 
@@ -4282,6 +4364,13 @@ TextureCubemap LoadTextureCubemap(Image image, int layout)
 // Load texture for rendering (framebuffer)
 // NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
 RenderTexture2D LoadRenderTexture(int width, int height)
+{
+    // Create color texture (default to RGBA)
+    return LoadRenderTextureFormat(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+}
+
+// Load texture for rendering with color pixel format
+static RenderTexture2D LoadRenderTextureFormat(int width, int height, int format)
 {
     RenderTexture2D target = { 0 };
 
@@ -4291,11 +4380,11 @@ RenderTexture2D LoadRenderTexture(int width, int height)
     {
         rlEnableFramebuffer(target.id);
 
-        // Create color texture (default to RGBA)
-        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        // Create color texture
+        target.texture.id = rlLoadTexture(NULL, width, height, format, 1);
         target.texture.width = width;
         target.texture.height = height;
-        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        target.texture.format = format;
         target.texture.mipmaps = 1;
 
         // Create depth renderbuffer/texture
@@ -4312,6 +4401,8 @@ RenderTexture2D LoadRenderTexture(int width, int height)
         // Check if fbo is complete with attachments (valid)
         if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
 
+        REGISTER_RESOURCE(RESOURCE_RENDER_TEXTURE, target.id, target.id, format, GetRenderTextureMemory(target), 0, "LoadRenderTexture");
+
         rlDisableFramebuffer();
     }
     else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
@@ -4340,6 +4431,25 @@ void UnloadTexture(Texture2D texture)
 {
     if (texture.id > 0)
     {
+        // Remove texture from managed textures (if required)
+        for (int i = 0; i < managedTextures.count; i++)
+        {
+            ManagedTexture *managed = &managedTextures.textures[i];
+
+            if (managed->texture.id == texture.id)
+            {
+                managedTextures.memory -= managed->memory;
+                RL_FREE(managed->fileName);
+                UnloadImage(managed->image);
+                UnloadImage(managed->evictImage);
+
+                managedTextures.count--;
+                *managed = managedTextures.textures[managedTextures.count];
+                break;
+            }
+        }
+
+        UNREGISTER_RESOURCE(RESOURCE_TEXTURE, texture.id);
         rlUnloadTexture(texture.id);
 
         TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
@@ -4363,6 +4473,8 @@ void UnloadRenderTexture(RenderTexture2D target)
 {
     if (target.id > 0)
     {
+        UNREGISTER_RESOURCE(RESOURCE_RENDER_TEXTURE, target.id);
+
         if (target.texture.id > 0)
         {
             // Color texture attached to FBO is deleted
@@ -4375,6 +4487,198 @@ void UnloadRenderTexture(RenderTexture2D target)
     }
 }
 
+// Get render texture from pool, reusing an available one with same size and format
+// NOTE: Intended for transient render targets (i.e. post-processing passes), released render textures
+// can be acquired again in the same frame, memory is only allocated when no render texture is available
+RenderTexture2D AcquireRenderTexture(int width, int height, int format)
+{
+    RenderTexturePool *pool = &renderTexturePool;
+    int index = -1;
+
+    // Look for an available render texture with same size and format
+    for (int i = 0; i < pool->count; i++)
+    {
+        RenderTexture2D *target = &pool->targets[i];
+
+        if (!pool->inUse[i] && (target->texture.width == width) && (target->texture.height == height) && (target->texture.format == format))
+        {
+            pool->inUse[i] = true;
+            return *target;
+        }
+
+        if (!pool->inUse[i] && (index == -1)) index = i;
+    }
+
+    // Pool full, first available render texture (with a different size or format) is replaced
+    if (pool->count < MAX_RENDER_TEXTURE_POOL_SIZE) index = pool->count;
+    else if (index >= 0)
+    {
+        pool->memory -= GetRenderTextureMemory(pool->targets[index]);
+        UnloadRenderTexture(pool->targets[index]);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "FBO: Render texture pool full (%i in use), render texture not pooled", MAX_RENDER_TEXTURE_POOL_SIZE);
+        return LoadRenderTextureFormat(width, height, format);
+    }
+
+    RenderTexture2D target = LoadRenderTextureFormat(width, height, format);
+
+    if (target.id > 0)
+    {
+        pool->targets[index] = target;
+        pool->inUse[index] = true;
+        if (index == pool->count) pool->count++;
+
+        pool->memory += GetRenderTextureMemory(target);
+        if (pool->memory > pool->peakMemory) pool->peakMemory = pool->memory;
+    }
+    else if (index < pool->count)
+    {
+        // Replaced render texture already unloaded, move last one to its place
+        pool->count--;
+        pool->targets[index] = pool->targets[pool->count];
+        pool->inUse[index] = pool->inUse[pool->count];
+    }
+
+    return target;
+}
+
+// Return render texture to pool, available for reuse
+// NOTE: Render textures not acquired from pool are unloaded
+void ReleaseRenderTexture(RenderTexture2D target)
+{
+    RenderTexturePool *pool = &renderTexturePool;
+
+    for (int i = 0; i < pool->count; i++)
+    {
+        if (pool->targets[i].id == target.id)
+        {
+            pool->inUse[i] = false;
+            return;
+        }
+    }
+
+    UnloadRenderTexture(target);
+}
+
+// Unload all render textures in pool from GPU memory (VRAM)
+// WARNING: Render textures currently acquired are also unloaded
+void UnloadRenderTexturePool(void)
+{
+    RenderTexturePool *pool = &renderTexturePool;
+
+    if (pool->count > 0) TRACELOG(LOG_INFO, "FBO: Render texture pool unloaded (%i render textures, peak memory: %i KB)", pool->count, pool->peakMemory/1024);
+
+    for (int i = 0; i < pool->count; i++) UnloadRenderTexture(pool->targets[i]);
+
+    int peakMemory = pool->peakMemory;
+    memset(pool, 0, sizeof(RenderTexturePool));
+    pool->peakMemory = peakMemory;
+}
+
+// Get render texture pool current memory size in bytes (VRAM)
+int GetRenderTexturePoolMemory(void)
+{
+    return renderTexturePool.memory;
+}
+
+// Get render texture pool peak memory size in bytes (VRAM)
+int GetRenderTexturePoolPeakMemory(void)
+{
+    return renderTexturePool.peakMemory;
+}
+
+// Load texture from file with managed residency, reloaded from file when required
+// NOTE: If managed textures exceed memory budget, least recently used ones are replaced by a
+// low resolution version (same texture id), full resolution is restored once texture is drawn again
+Texture2D LoadTextureManaged(const char *fileName)
+{
+    Texture2D texture = { 0 };
+
+    Image image = LoadImage(fileName);
+
+    if (image.data != NULL)
+    {
+        texture = LoadManagedTexture(image, fileName);
+        UnloadImage(image);
+    }
+
+    return texture;
+}
+
+// Load texture from image with managed residency, image copy kept in CPU memory (RAM)
+// NOTE: image is not unloaded, it must be done manually
+Texture2D LoadTextureManagedFromImage(Image image)
+{
+    Texture2D texture = { 0 };
+
+    if (image.data != NULL) texture = LoadManagedTexture(image, NULL);
+    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
+
+    return texture;
+}
+
+// Set managed textures memory budget in bytes (VRAM), 0 for no budget
+// NOTE: Least recently used textures are evicted at the end of the frame (EndDrawing()),
+// textures drawn on current frame are never evicted, so budget could be exceeded
+void SetManagedTextureBudget(int budget)
+{
+    managedTextures.budget = budget;
+}
+
+// Get managed textures current memory size in bytes (VRAM)
+int GetManagedTextureMemory(void)
+{
+    return managedTextures.memory;
+}
+
+// Check if a managed texture is evicted (low resolution version in VRAM)
+bool IsTextureEvicted(Texture2D texture)
+{
+    for (int i = 0; i < managedTextures.count; i++)
+    {
+        if (managedTextures.textures[i].texture.id == texture.id) return managedTextures.textures[i].evicted;
+    }
+
+    return false;
+}
+
+// Update managed textures residency, called once per frame by EndDrawing()
+// NOTE: Evicted textures drawn on current frame are restored, they are drawn at low resolution until next frame
+void UpdateManagedTextures(void)
+{
+    ManagedTextures *managed = &managedTextures;
+    unsigned int frame = rlGetFrameCounter();
+
+    for (int i = 0; i < managed->count; i++)
+    {
+        if (managed->textures[i].evicted && (rlGetTextureLastFrame(managed->textures[i].texture.id) == frame)) RestoreManagedTexture(&managed->textures[i]);
+    }
+
+    // Evict least recently used textures until memory fits budget
+    while ((managed->budget > 0) && (managed->memory > managed->budget))
+    {
+        int index = -1;
+        unsigned int lastFrame = frame;
+
+        for (int i = 0; i < managed->count; i++)
+        {
+            unsigned int textureFrame = rlGetTextureLastFrame(managed->textures[i].texture.id);
+
+            if (!managed->textures[i].evicted && (textureFrame < lastFrame))
+            {
+                index = i;
+                lastFrame = textureFrame;
+            }
+        }
+
+        if (index == -1) break;     // Remaining textures drawn on current frame
+
+        EvictManagedTexture(&managed->textures[index]);
+    }
+}
+
 // Update GPU texture with new data
 // NOTE: pixels data must match texture.format
 void UpdateTexture(Texture2D texture, const void *pixels)
@@ -4389,6 +4693,82 @@ void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
     rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
 }
 
+// Load texture for streaming updates through pixel buffers
+// NOTE: Useful for per-frame updated textures (video, CPU-rendered surfaces),
+// pixel data is written directly into mapped buffers and uploaded while rendering
+TextureStream LoadTextureStream(int width, int height, int format)
+{
+    TextureStream stream = { 0 };
+
+    stream.texture.id = rlLoadTexture(NULL, width, height, format, 1);
+
+    if (stream.texture.id > 0)
+    {
+        stream.texture.width = width;
+        stream.texture.height = height;
+        stream.texture.format = format;
+        stream.texture.mipmaps = 1;
+
+        rlTextureStream *buffers = (rlTextureStream *)RL_MALLOC(sizeof(rlTextureStream));
+        *buffers = rlLoadTextureStream(stream.texture.id, width, height, format);
+
+        if (buffers->textureId > 0)
+        {
+            stream.buffers = buffers;
+
+            // NOTE: Pixel buffers are allocated in GPU memory, CPU memory used if not supported
+            REGISTER_RESOURCE(RESOURCE_TEXTURE, stream.texture.id, stream.texture.id, format,
+                GetTextureMemory(stream.texture) + ((buffers->data != NULL)? 0 : RL_TEXTURE_STREAM_BUFFERS*buffers->size),
+                (buffers->data != NULL)? buffers->size : 0, "LoadTextureStream");
+        }
+        else
+        {
+            RL_FREE(buffers);
+            rlUnloadTexture(stream.texture.id);
+            stream.texture = (Texture2D){ 0 };
+        }
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load texture stream");
+
+    return stream;
+}
+
+// Check if a texture stream is ready
+bool IsTextureStreamReady(TextureStream stream)
+{
+    return (IsTextureReady(stream.texture) && (stream.buffers != NULL));
+}
+
+// Unload texture stream from GPU memory (VRAM)
+void UnloadTextureStream(TextureStream stream)
+{
+    if (stream.buffers != NULL)
+    {
+        rlUnloadTextureStream((rlTextureStream *)stream.buffers);
+        RL_FREE(stream.buffers);
+    }
+
+    UnloadTexture(stream.texture);
+}
+
+// Begin texture stream update, returns memory to write new pixel data
+// NOTE: Pixel data must match texture format and size, all pixels must be written
+// WARNING: Returned memory is only valid until EndTextureStreamUpdate(), it should not be read
+void *BeginTextureStreamUpdate(TextureStream stream)
+{
+    void *pixels = NULL;
+
+    if (stream.buffers != NULL) pixels = rlMapTextureStream((rlTextureStream *)stream.buffers);
+
+    return pixels;
+}
+
+// End texture stream update, pixel data uploaded while rendering
+void EndTextureStreamUpdate(TextureStream stream)
+{
+    if (stream.buffers != NULL) rlUnmapTextureStream((rlTextureStream *)stream.buffers);
+}
+
 //------------------------------------------------------------------------------------
 // Texture configuration functions
 //------------------------------------------------------------------------------------
@@ -4582,31 +4962,25 @@ void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2
             bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
         }
 
+        // Texture coordinates, horizontal flip swaps left and right coordinates
+        float left = source.x/width;
+        float right = (source.x + source.width)/width;
+        float top = source.y/height;
+        float bottom = (source.y + source.height)/height;
+
+        if (flipX) { float temp = left; left = right; right = temp; }
+
+        // Quad vertex: top-left, bottom-left, bottom-right, top-right
+        float vertices[8] = { topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y };
+        float texcoords[8] = { left, top, left, bottom, right, bottom, right, top };
+
         rlSetTexture(texture.id);
         rlBegin(RL_QUADS);
 
             rlColor4ub(tint.r, tint.g, tint.b, tint.a);
             rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
-
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
-
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+            rlVertexTexCoord2fv(vertices, texcoords, 4);
 
         rlEnd();
         rlSetTexture(0);
@@ -4653,6 +5027,166 @@ void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2
     }
 }
 
+// Draw multiple parts of a texture with 'pro' parameters, one call for all sprites
+// NOTE: sources, origins, rotations and tints are optional (NULL): full texture, no origin offset,
+// no rotation and WHITE tint are used respectively. Quads are generated in chunks, with SIMD
+// vertex computation when available, and every chunk is submitted to current batch with one call
+void DrawTextureBatch(Texture2D texture, const Rectangle *sources, const Rectangle *dests, const Vector2 *origins, const float *rotations, const Color *tints, int count)
+{
+    // Check if texture is valid
+    if ((texture.id == 0) || (dests == NULL) || (count <= 0)) return;
+
+    float width = (float)texture.width;
+    float height = (float)texture.height;
+    SpritesChunk *chunk = &spritesChunk;
+
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+        for (int first = 0; first < count; first += MAX_SPRITES_CHUNK_SIZE)
+        {
+            int spriteCount = ((count - first) < MAX_SPRITES_CHUNK_SIZE)? (count - first) : MAX_SPRITES_CHUNK_SIZE;
+
+            // Gather sprites parameters, texture coordinates and colors are generated on this pass
+            for (int i = 0; i < spriteCount; i++)
+            {
+                int k = first + i;
+                Rectangle source = (sources != NULL)? sources[k] : (Rectangle){ 0.0f, 0.0f, width, height };
+                Rectangle dest = dests[k];
+                float rotation = (rotations != NULL)? rotations[k] : 0.0f;
+                Color tint = (tints != NULL)? tints[k] : WHITE;
+
+                bool flipX = false;
+
+                if (source.width < 0) { flipX = true; source.width *= -1; }
+                if (source.height < 0) source.y -= source.height;
+
+                chunk->x[i] = dest.x;
+                chunk->y[i] = dest.y;
+                chunk->dx[i] = (origins != NULL)? -origins[k].x : 0.0f;
+                chunk->dy[i] = (origins != NULL)? -origins[k].y : 0.0f;
+                chunk->width[i] = dest.width;
+                chunk->height[i] = dest.height;
+
+                // Only calculate rotation if needed
+                if (rotation == 0.0f) { chunk->cos[i] = 1.0f; chunk->sin[i] = 0.0f; }
+                else { chunk->cos[i] = cosf(rotation*DEG2RAD); chunk->sin[i] = sinf(rotation*DEG2RAD); }
+
+                // Texture coordinates, horizontal flip swaps left and right coordinates
+                float left = source.x/width;
+                float right = (source.x + source.width)/width;
+                float top = source.y/height;
+                float bottom = (source.y + source.height)/height;
+
+                if (flipX) { float temp = left; left = right; right = temp; }
+
+                // Quad vertex: top-left, bottom-left, bottom-right, top-right
+                float *texcoord = chunk->texcoords + 8*i;
+                texcoord[0] = left; texcoord[1] = top;
+                texcoord[2] = left; texcoord[3] = bottom;
+                texcoord[4] = right; texcoord[5] = bottom;
+                texcoord[6] = right; texcoord[7] = top;
+
+                for (int v = 0; v < 4; v++) memcpy(chunk->colors + 16*i + 4*v, &tint, 4);
+            }
+
+            // Compute quads vertex, corners are computed from top-left corner and rotated quad sides:
+            // topLeft = position + rotate(-origin), topRight = topLeft + rotate(width, 0),
+            // bottomLeft = topLeft + rotate(0, height), bottomRight = bottomLeft + rotate(width, 0)
+            int i = 0;
+
+#if defined(TEXTURE_BATCH_SIMD_SSE)
+            for (; i <= (spriteCount - 4); i += 4)
+            {
+                __m128 x = _mm_loadu_ps(chunk->x + i);
+                __m128 y = _mm_loadu_ps(chunk->y + i);
+                __m128 dx = _mm_loadu_ps(chunk->dx + i);
+                __m128 dy = _mm_loadu_ps(chunk->dy + i);
+                __m128 w = _mm_loadu_ps(chunk->width + i);
+                __m128 h = _mm_loadu_ps(chunk->height + i);
+                __m128 c = _mm_loadu_ps(chunk->cos + i);
+                __m128 s = _mm_loadu_ps(chunk->sin + i);
+
+                __m128 tlx = _mm_sub_ps(_mm_add_ps(x, _mm_mul_ps(dx, c)), _mm_mul_ps(dy, s));
+                __m128 tly = _mm_add_ps(_mm_add_ps(y, _mm_mul_ps(dx, s)), _mm_mul_ps(dy, c));
+                __m128 wc = _mm_mul_ps(w, c);
+                __m128 ws = _mm_mul_ps(w, s);
+                __m128 blx = _mm_sub_ps(tlx, _mm_mul_ps(h, s));
+                __m128 bly = _mm_add_ps(tly, _mm_mul_ps(h, c));
+                __m128 brx = _mm_add_ps(blx, wc);
+                __m128 bry = _mm_add_ps(bly, ws);
+                __m128 trx = _mm_add_ps(tlx, wc);
+                __m128 tr_y = _mm_add_ps(tly, ws);
+
+                // Transpose to get every sprite vertex contiguous: [tlx, tly, blx, bly], [brx, bry, trx, try]
+                _MM_TRANSPOSE4_PS(tlx, tly, blx, bly);
+                _MM_TRANSPOSE4_PS(brx, bry, trx, tr_y);
+
+                float *vertex = chunk->vertices + 8*i;
+                _mm_storeu_ps(vertex, tlx); _mm_storeu_ps(vertex + 4, brx);
+                _mm_storeu_ps(vertex + 8, tly); _mm_storeu_ps(vertex + 12, bry);
+                _mm_storeu_ps(vertex + 16, blx); _mm_storeu_ps(vertex + 20, trx);
+                _mm_storeu_ps(vertex + 24, bly); _mm_storeu_ps(vertex + 28, tr_y);
+            }
+#elif defined(TEXTURE_BATCH_SIMD_NEON)
+            for (; i <= (spriteCount - 4); i += 4)
+            {
+                float32x4_t x = vld1q_f32(chunk->x + i);
+                float32x4_t y = vld1q_f32(chunk->y + i);
+                float32x4_t dx = vld1q_f32(chunk->dx + i);
+                float32x4_t dy = vld1q_f32(chunk->dy + i);
+                float32x4_t w = vld1q_f32(chunk->width + i);
+                float32x4_t h = vld1q_f32(chunk->height + i);
+                float32x4_t c = vld1q_f32(chunk->cos + i);
+                float32x4_t s = vld1q_f32(chunk->sin + i);
+
+                float32x4_t tlx = vmlsq_f32(vmlaq_f32(x, dx, c), dy, s);
+                float32x4_t tly = vmlaq_f32(vmlaq_f32(y, dx, s), dy, c);
+                float32x4_t wc = vmulq_f32(w, c);
+                float32x4_t ws = vmulq_f32(w, s);
+                float32x4_t blx = vmlsq_f32(tlx, h, s);
+                float32x4_t bly = vmlaq_f32(tly, h, c);
+
+                // Interleaved stores get every sprite vertex contiguous: left corners [tlx, tly, blx, bly], right corners [brx, bry, trx, try]
+                float32x4x4_t leftCorners = { { tlx, tly, blx, bly } };
+                float32x4x4_t rightCorners = { { vaddq_f32(blx, wc), vaddq_f32(bly, ws), vaddq_f32(tlx, wc), vaddq_f32(tly, ws) } };
+                float leftValues[16] = { 0 };
+                float rightValues[16] = { 0 };
+                vst4q_f32(leftValues, leftCorners);
+                vst4q_f32(rightValues, rightCorners);
+
+                for (int k = 0; k < 4; k++)
+                {
+                    memcpy(chunk->vertices + 8*(i + k), leftValues + 4*k, 4*sizeof(float));
+                    memcpy(chunk->vertices + 8*(i + k) + 4, rightValues + 4*k, 4*sizeof(float));
+                }
+            }
+#endif
+            for (; i < spriteCount; i++)
+            {
+                float c = chunk->cos[i];
+                float s = chunk->sin[i];
+                float tlx = chunk->x[i] + chunk->dx[i]*c - chunk->dy[i]*s;
+                float tly = chunk->y[i] + chunk->dx[i]*s + chunk->dy[i]*c;
+                float blx = tlx - chunk->height[i]*s;
+                float bly = tly + chunk->height[i]*c;
+
+                float *vertex = chunk->vertices + 8*i;
+                vertex[0] = tlx; vertex[1] = tly;
+                vertex[2] = blx; vertex[3] = bly;
+                vertex[4] = blx + chunk->width[i]*c; vertex[5] = bly + chunk->width[i]*s;
+                vertex[6] = tlx + chunk->width[i]*c; vertex[7] = tly + chunk->width[i]*s;
+            }
+
+            rlVertexColor2fv(chunk->vertices, chunk->texcoords, chunk->colors, 4*spriteCount);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
 // Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
 void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
 {
@@ -5570,4 +6104,121 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Get render texture memory size in bytes (color and depth)
+// NOTE: Depth renderbuffer is considered 24bit, usually padded to 32bit by drivers
+static int GetRenderTextureMemory(RenderTexture2D target)
+{
+    return GetPixelDataSize(target.texture.width, target.texture.height, target.texture.format) + target.depth.width*target.depth.height*4;
+}
+
+// Get texture memory size in bytes (including mipmaps)
+static int GetTextureMemory(Texture2D texture)
+{
+    int size = 0;
+    int width = texture.width;
+    int height = texture.height;
+
+    for (int i = 0; i < texture.mipmaps; i++)
+    {
+        size += GetPixelDataSize(width, height, texture.format);
+
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    return size;
+}
+
+// Load texture with managed residency
+// NOTE: Low resolution version is generated on loading, compressed textures use a single pixel placeholder
+static Texture2D LoadManagedTexture(Image image, const char *fileName)
+{
+    ManagedTextures *managed = &managedTextures;
+
+    if (managed->count >= MAX_MANAGED_TEXTURES)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Managed textures limit reached (%i), texture residency not managed", MAX_MANAGED_TEXTURES);
+        return LoadTextureFromImage(image);
+    }
+
+    Texture2D texture = LoadTextureFromImage(image);
+    if (texture.id == 0) return texture;
+
+    ManagedTexture *entry = &managed->textures[managed->count];
+    memset(entry, 0, sizeof(ManagedTexture));
+    entry->texture = texture;
+    entry->memory = GetTextureMemory(texture);
+
+    if (fileName != NULL)
+    {
+        entry->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+        strcpy(entry->fileName, fileName);
+    }
+    else entry->image = ImageCopy(image);
+
+    if (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        // NOTE: Only first mipmap level is scaled, mipmaps are generated again if required
+        entry->evictImage = ImageCopy(image);
+        entry->evictImage.mipmaps = 1;
+
+        int width = image.width/MANAGED_TEXTURE_EVICT_SCALE;
+        int height = image.height/MANAGED_TEXTURE_EVICT_SCALE;
+        ImageResize(&entry->evictImage, (width > 1)? width : 1, (height > 1)? height : 1);
+        if (image.mipmaps > 1) ImageMipmaps(&entry->evictImage);
+    }
+    else
+    {
+        unsigned char *pixel = (unsigned char *)RL_MALLOC(4);
+        pixel[0] = 130; pixel[1] = 130; pixel[2] = 130; pixel[3] = 255;     // GRAY
+
+        entry->evictImage = (Image){ pixel, 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    }
+
+    // Track texture usage, updated on texture drawing
+    rlTrackTextureUsage(texture.id);
+
+    managed->memory += entry->memory;
+    managed->count++;
+
+    return texture;
+}
+
+// Evict managed texture, replaced by low resolution version
+static void EvictManagedTexture(ManagedTexture *managed)
+{
+    Image image = managed->evictImage;
+    rlReloadTexture(managed->texture.id, image.data, image.width, image.height, image.format, image.mipmaps);
+
+    managed->evicted = true;
+    managedTextures.memory -= managed->memory;
+    managed->memory = GetTextureMemory((Texture2D){ managed->texture.id, image.width, image.height, image.mipmaps, image.format });
+    managedTextures.memory += managed->memory;
+
+    TRACELOGD("TEXTURE: [ID %i] Managed texture evicted from VRAM (GPU)", managed->texture.id);
+}
+
+// Restore managed texture at full resolution
+static void RestoreManagedTexture(ManagedTexture *managed)
+{
+    Image image = (managed->fileName != NULL)? LoadImage(managed->fileName) : managed->image;
+
+    // NOTE: Texture file could have changed, image must match texture
+    if ((image.data != NULL) && (image.width == managed->texture.width) && (image.height == managed->texture.height) &&
+        (image.format == managed->texture.format) && (image.mipmaps == managed->texture.mipmaps))
+    {
+        rlReloadTexture(managed->texture.id, image.data, image.width, image.height, image.format, image.mipmaps);
+
+        managed->evicted = false;
+        managedTextures.memory -= managed->memory;
+        managed->memory = GetTextureMemory(managed->texture);
+        managedTextures.memory += managed->memory;
+
+        TRACELOGD("TEXTURE: [ID %i] Managed texture restored to VRAM (GPU)", managed->texture.id);
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to restore managed texture, image data not available", managed->texture.id);
+
+    if (managed->fileName != NULL) UnloadImage(image);
+}
+
 #endif      // SUPPORT_MODULE_RTEXTURES
@@ -67,6 +67,19 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+// Resource registry entry
+typedef struct ResourceEntry {
+    unsigned long long key;                         // Resource key (OpenGL id or audio buffer address)
+    ResourceInfo info;                              // Resource info
+} ResourceEntry;
+
+static ResourceEntry *resources = NULL;             // Loaded resources registry
+static int resourceCount = 0;                       // Loaded resources count
+static int resourceCapacity = 0;                    // Loaded resources registry capacity
+static char resourceTag[32] = { 0 };                // Owner tag for resources loaded next
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -439,6 +452,203 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Resource registry
+//----------------------------------------------------------------------------------
+
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+// Register loaded resource memory, replacing previous info if already registered
+// NOTE: Called by raylib modules on resources loading, tagged with current owner tag
+void RegisterResource(int type, unsigned long long key, unsigned int id, int format, int gpuSize, int cpuSize, const char *source)
+{
+    ResourceEntry *entry = NULL;
+
+    for (int i = resourceCount - 1; i >= 0; i--)
+    {
+        if ((resources[i].key == key) && (resources[i].info.type == type)) { entry = &resources[i]; break; }
+    }
+
+    if (entry == NULL)
+    {
+        if (resourceCount == resourceCapacity)
+        {
+            int capacity = (resourceCapacity > 0)? resourceCapacity*2 : 256;
+            ResourceEntry *newResources = (ResourceEntry *)RL_REALLOC(resources, capacity*sizeof(ResourceEntry));
+
+            if (newResources == NULL) return;
+
+            resources = newResources;
+            resourceCapacity = capacity;
+        }
+
+        entry = &resources[resourceCount];
+        resourceCount++;
+    }
+
+    entry->key = key;
+    entry->info.type = type;
+    entry->info.id = id;
+    entry->info.format = format;
+    entry->info.gpuSize = gpuSize;
+    entry->info.cpuSize = cpuSize;
+    entry->info.source = source;
+    memcpy(entry->info.tag, resourceTag, sizeof(resourceTag));
+}
+
+// Unregister unloaded resource
+void UnregisterResource(int type, unsigned long long key)
+{
+    // NOTE: Search backwards, recently loaded resources are usually unloaded first
+    for (int i = resourceCount - 1; i >= 0; i--)
+    {
+        if ((resources[i].key == key) && (resources[i].info.type == type))
+        {
+            resourceCount--;
+            resources[i] = resources[resourceCount];
+
+            if (resourceCount == 0)
+            {
+                RL_FREE(resources);
+                resources = NULL;
+                resourceCapacity = 0;
+            }
+            break;
+        }
+    }
+}
+
+// Unload resource registry, entries still registered are discarded
+// NOTE: Called by CloseWindow(), registry is allocated again if resources are loaded later
+void UnloadResourceRegistry(void)
+{
+    RL_FREE(resources);
+    resources = NULL;
+    resourceCount = 0;
+    resourceCapacity = 0;
+}
+#endif
+
+// Set owner tag for resources loaded next (NULL to clear)
+// NOTE: Useful to group resources by owner (i.e. level, scene, system) on resources queries
+void SetResourceTag(const char *tag)
+{
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+    memset(resourceTag, 0, sizeof(resourceTag));
+    if (tag != NULL) strncpy(resourceTag, tag, sizeof(resourceTag) - 1);
+#endif
+}
+
+// Get number of loaded resources by type (-1 for all types)
+int GetResourceCount(int type)
+{
+    int count = 0;
+
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+    for (int i = 0; i < resourceCount; i++)
+    {
+        if ((type < 0) || (resources[i].info.type == type)) count++;
+    }
+#endif
+
+    return count;
+}
+
+// Get memory size of loaded resources by type (-1 for all types), GPU (VRAM) or CPU (RAM), in bytes
+long long GetResourceMemory(int type, bool gpu)
+{
+    long long size = 0;
+
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+    for (int i = 0; i < resourceCount; i++)
+    {
+        if ((type < 0) || (resources[i].info.type == type)) size += gpu? resources[i].info.gpuSize : resources[i].info.cpuSize;
+    }
+#endif
+
+    return size;
+}
+
+// Get largest loaded resources (GPU + CPU memory), returns number of resources filled
+// NOTE: Resources are sorted by size, largest first
+int GetLargestResources(ResourceInfo *largest, int count)
+{
+    int filled = 0;
+
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+    if ((largest == NULL) || (count <= 0)) return 0;
+
+    // Insertion into sorted output, only count largest resources are kept
+    for (int i = 0; i < resourceCount; i++)
+    {
+        long long size = (long long)resources[i].info.gpuSize + resources[i].info.cpuSize;
+        int k = filled;
+
+        while ((k > 0) && (((long long)largest[k - 1].gpuSize + largest[k - 1].cpuSize) < size)) k--;
+
+        if (k < count)
+        {
+            int last = (filled < count)? filled : count - 1;
+            for (int j = last; j > k; j--) largest[j] = largest[j - 1];
+
+            largest[k] = resources[i].info;
+            if (filled < count) filled++;
+        }
+    }
+#endif
+
+    return filled;
+}
+
+// Export loaded resources list and memory totals to text file, returns true on success
+bool ExportResourceRegistry(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+    static const char *typeNames[] = { "TEXTURE", "RENDER_TEXTURE", "MESH", "SHADER", "FONT", "SOUND", "MUSIC" };
+    const int typeCount = sizeof(typeNames)/sizeof(typeNames[0]);
+
+    // NOTE: Text buffer size estimated by line length (up to 160 chars)
+    int textSize = (resourceCount + typeCount + 16)*160;
+    char *text = (char *)RL_CALLOC(textSize, sizeof(char));
+    int offset = 0;
+
+    if (text == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocate memory to export resource registry", fileName);
+        return false;
+    }
+
+    offset += snprintf(text + offset, textSize - offset, "# raylib resource registry: %i resources\n", resourceCount);
+    offset += snprintf(text + offset, textSize - offset, "# type, count, gpu bytes, cpu bytes\n");
+    for (int t = 0; t < typeCount; t++)
+    {
+        offset += snprintf(text + offset, textSize - offset, "total: %s, %i, %lld, %lld\n", typeNames[t], GetResourceCount(t), GetResourceMemory(t, true), GetResourceMemory(t, false));
+    }
+    offset += snprintf(text + offset, textSize - offset, "total: ALL, %i, %lld, %lld\n", resourceCount, GetResourceMemory(-1, true), GetResourceMemory(-1, false));
+
+    offset += snprintf(text + offset, textSize - offset, "# type, id, format, gpu bytes, cpu bytes, tag, source\n");
+    for (int i = 0; i < resourceCount; i++)
+    {
+        ResourceInfo *info = &resources[i].info;
+
+        offset += snprintf(text + offset, textSize - offset, "resource: %s, %u, %i, %i, %i, %s, %s\n",
+            ((info->type >= 0) && (info->type < typeCount))? typeNames[info->type] : "UNKNOWN", info->id, info->format,
+            info->gpuSize, info->cpuSize, (info->tag[0] != '\0')? info->tag : "-", (info->source != NULL)? info->source : "-");
+    }
+
+    success = SaveFileText(fileName, text);
+    RL_FREE(text);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Resource registry exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export resource registry", fileName);
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Resource registry not supported, enable SUPPORT_RESOURCE_REGISTRY");
+#endif
+
+    return success;
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
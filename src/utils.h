@@ -45,6 +45,14 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+    #define REGISTER_RESOURCE(type, key, id, format, gpuSize, cpuSize, source) RegisterResource(type, key, id, format, gpuSize, cpuSize, source)
+    #define UNREGISTER_RESOURCE(type, key) UnregisterResource(type, key)
+#else
+    #define REGISTER_RESOURCE(type, key, id, format, gpuSize, cpuSize, source) (void)0
+    #define UNREGISTER_RESOURCE(type, key) (void)0
+#endif
+
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------
@@ -74,6 +82,13 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+#if defined(SUPPORT_RESOURCE_REGISTRY)
+// NOTE: Resources are identified by type and key (OpenGL id or audio buffer address)
+void RegisterResource(int type, unsigned long long key, unsigned int id, int format, int gpuSize, int cpuSize, const char *source); // Register loaded resource memory
+void UnregisterResource(int type, unsigned long long key);             // Unregister unloaded resource
+void UnloadResourceRegistry(void);                                      // Unload resource registry (called on CloseWindow())
+#endif
+
 #if defined(__cplusplus)
 }
 #endif